@@ -0,0 +1,58 @@
+/**
+ ******************************************************************************
+ * @file			: SM72445.bench.hpp
+ * @brief			: Common fixtures for SM72445 benchmarks.
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#pragma once
+
+#include "benchmark/benchmark.h"
+
+#include "SM72445_X.hpp"
+
+/**
+ * @brief Zero-latency in-process I2C serving fixed register images.
+ */
+class FakeI2C : public SM72445::I2C {
+public:
+	array<Register, 8> registers{}; // Indexed by MemoryAddress - REG0.
+
+	virtual optional<Register> read(
+		DeviceAddress deviceAddress, //
+		MemoryAddress memoryAddress
+	) override final {
+		(void)deviceAddress;
+		return this->registers[static_cast<uint8_t>(memoryAddress) & 0x7u];
+	}
+
+	virtual optional<Register> write(
+		DeviceAddress deviceAddress,
+		MemoryAddress memoryAddress,
+		Register	  data
+	) override final {
+		(void)deviceAddress;
+		this->registers[static_cast<uint8_t>(memoryAddress) & 0x7u] = data;
+		return data;
+	}
+};
+
+/**
+ * @brief A fixed table of pseudo-random register images, so that benchmarks do not
+ * operate on a single constant the compiler could fold.
+ */
+inline const array<SM72445::Register, 256> &getRegisterSamples(void) {
+	static const array<SM72445::Register, 256> samples = [] {
+		array<SM72445::Register, 256> values{};
+		uint64_t					  state = 0x9E37'79B9'7F4A'7C15ull;
+		for (auto &value : values) {
+			state ^= state << 13u;
+			state ^= state >> 7u;
+			state ^= state << 17u;
+			value  = state & 0x00FF'FFFF'FFFF'FFFFull;
+		}
+		return values;
+	}();
+	return samples;
+}
@@ -0,0 +1,91 @@
+/**
+ ******************************************************************************
+ * @file			: SM72445_Bus.bench.cpp
+ * @brief			: Benchmarks of polling strategies by modelled bus time.
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "SM72445.bench.hpp"
+
+#include "SM72445_ModelledBus.hpp"
+
+using DeviceAddress = SM72445::DeviceAddress;
+using ClockRate		= ModelledBusI2C::ClockRate;
+
+/**
+ * @brief Reports the modelled bus time per iteration alongside the CPU time.
+ *
+ * @details The benchmark argument selects the bus clock rate in kHz.
+ */
+class SM72445_Bus_Bench : public benchmark::Fixture {
+public:
+	FakeI2C						  i2c{};
+	std::optional<ModelledBusI2C> bus{};
+	std::optional<SM72445_X>	  sm72445{};
+
+	void SetUp(const benchmark::State &state) override {
+		const auto clockRate = static_cast<ClockRate>(uint32_t(state.range(0)) * 1'000u);
+		bus.emplace(i2c, clockRate);
+		sm72445.emplace(*bus, DeviceAddress::ADDR001, .1f, .2f, .3f, .4f);
+	}
+
+	void report(benchmark::State &state) {
+		state.counters["bus_us"] = benchmark::Counter(
+			double(bus->getBusyTime()) / 1'000.0,
+			benchmark::Counter::kAvgIterations
+		);
+		state.SetItemsProcessed(state.iterations());
+	}
+};
+
+BENCHMARK_DEFINE_F(SM72445_Bus_Bench, bulkMeasurement)(benchmark::State &state) {
+	for (auto _ : state) {
+		auto measurements = sm72445->getElectricalMeasurements();
+		benchmark::DoNotOptimize(measurements);
+	}
+	report(state);
+}
+
+BENCHMARK_DEFINE_F(SM72445_Bus_Bench, perChannelMeasurement)(benchmark::State &state) {
+	for (auto _ : state) {
+		auto iIn  = sm72445->getInputCurrent();
+		auto vIn  = sm72445->getInputVoltage();
+		auto iOut = sm72445->getOutputCurrent();
+		auto vOut = sm72445->getOutputVoltage();
+		benchmark::DoNotOptimize(iIn);
+		benchmark::DoNotOptimize(vIn);
+		benchmark::DoNotOptimize(iOut);
+		benchmark::DoNotOptimize(vOut);
+	}
+	report(state);
+}
+
+BENCHMARK_DEFINE_F(SM72445_Bus_Bench, configFetchModifyWrite)(benchmark::State &state) {
+	for (auto _ : state) {
+		auto written = sm72445->setConfig(
+			sm72445->getConfigBuilder(true).setMaxOutputCurrentOverride(2.0f).build()
+		);
+		benchmark::DoNotOptimize(written);
+	}
+	report(state);
+}
+
+BENCHMARK_DEFINE_F(SM72445_Bus_Bench, configWrite)(benchmark::State &state) {
+	for (auto _ : state) {
+		auto written = sm72445->setConfig(
+			sm72445->getConfigBuilder().setMaxOutputCurrentOverride(2.0f).build()
+		);
+		benchmark::DoNotOptimize(written);
+	}
+	report(state);
+}
+
+static void applyClockRates(benchmark::internal::Benchmark *benchmark) {
+	benchmark->ArgName("kHz")->Arg(100)->Arg(400)->Arg(1000);
+}
+
+BENCHMARK_REGISTER_F(SM72445_Bus_Bench, bulkMeasurement)->Apply(applyClockRates);
+BENCHMARK_REGISTER_F(SM72445_Bus_Bench, perChannelMeasurement)->Apply(applyClockRates);
+BENCHMARK_REGISTER_F(SM72445_Bus_Bench, configFetchModifyWrite)->Apply(applyClockRates);
+BENCHMARK_REGISTER_F(SM72445_Bus_Bench, configWrite)->Apply(applyClockRates);
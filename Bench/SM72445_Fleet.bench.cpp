@@ -0,0 +1,96 @@
+/**
+ ******************************************************************************
+ * @file			: SM72445_Fleet.bench.cpp
+ * @brief			: Benchmarks of the fleet kernels over 100k devices.
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "SM72445.bench.hpp"
+
+#include <deque>
+#include <vector>
+
+#include "SM72445_FleetKernels.hpp"
+
+using DeviceAddress	 = SM72445::DeviceAddress;
+using InstructionSet = FleetKernels::InstructionSet;
+
+/**
+ * @brief A fleet of 100k devices with pseudo-random measurements.
+ *
+ * @details The benchmark argument selects the FleetKernels::InstructionSet.
+ */
+class SM72445_Fleet_Bench : public benchmark::Fixture {
+public:
+	static constexpr size_t DEVICES = 100'000u;
+
+	FakeI2C				  i2c{};
+	std::deque<SM72445_X> devices{};
+	FleetState			  fleet{};
+
+	std::vector<float>		powerIn, powerOut, efficiency;
+	FleetKernels::Ranking	top[16], bottom[16];
+	FleetKernels::Outputs	outputs{};
+	InstructionSet			original = FleetKernels::getInstructionSet();
+
+	void SetUp(const benchmark::State &) override {
+		if (this->fleet.size()) return;
+
+		const auto &samples = getRegisterSamples();
+
+		this->fleet.reserve(DEVICES);
+		for (size_t i = 0; i < DEVICES; i++) {
+			const float gain = 0.1f + float(i % 7u) * 0.05f;
+			this->devices.emplace_back(i2c, DeviceAddress::ADDR001, gain, gain, gain, gain);
+			this->fleet.add(this->devices.back());
+			this->fleet.update(i, SM72445::Reg1(samples[i & 0xFFu] ^ i));
+		}
+
+		this->powerIn.resize(DEVICES);
+		this->powerOut.resize(DEVICES);
+		this->efficiency.resize(DEVICES);
+		this->outputs = {
+			this->powerIn.data(),
+			this->powerOut.data(),
+			this->efficiency.data(),
+			this->top,
+			this->bottom,
+			16u,
+		};
+	}
+
+	void TearDown(const benchmark::State &) override {
+		FleetKernels::setInstructionSet(this->original);
+	}
+};
+
+BENCHMARK_DEFINE_F(SM72445_Fleet_Bench, evaluate)(benchmark::State &state) {
+	if (!FleetKernels::setInstructionSet(static_cast<InstructionSet>(state.range(0)))) {
+		state.SkipWithError("Instruction set not supported");
+		return;
+	}
+
+	for (auto _ : state) {
+		auto summary = FleetKernels::evaluate(fleet, outputs);
+		benchmark::DoNotOptimize(summary);
+		benchmark::ClobberMemory();
+	}
+	state.SetItemsProcessed(int64_t(state.iterations() * DEVICES));
+}
+
+BENCHMARK_DEFINE_F(SM72445_Fleet_Bench, convert)(benchmark::State &state) {
+	for (auto _ : state) {
+		fleet.convert(SM72445::ElectricalProperty::VOLTAGE_OUT, powerOut.data());
+		benchmark::ClobberMemory();
+	}
+	state.SetItemsProcessed(int64_t(state.iterations() * DEVICES));
+}
+
+BENCHMARK_REGISTER_F(SM72445_Fleet_Bench, evaluate)
+	->ArgName("isa")
+	->Arg(int(InstructionSet::SCALAR))
+	->Arg(int(InstructionSet::AVX2))
+	->Arg(int(InstructionSet::NEON))
+	->Unit(benchmark::kMicrosecond);
+BENCHMARK_REGISTER_F(SM72445_Fleet_Bench, convert)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,67 @@
+/**
+ ******************************************************************************
+ * @file			: SM72445_Reg.bench.cpp
+ * @brief			: Benchmarks for SM72445::RegX encoding and decoding.
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "SM72445.bench.hpp"
+
+using Register = SM72445::Register;
+
+template <typename Reg>
+static void BM_RegDecode(benchmark::State &state) {
+	const auto &samples = getRegisterSamples();
+	size_t		i		= 0;
+
+	for (auto _ : state) {
+		Reg reg{samples[i++ & 0xFFu]};
+		benchmark::DoNotOptimize(reg);
+		benchmark::ClobberMemory();
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+
+template <typename Reg>
+static void BM_RegEncode(benchmark::State &state) {
+	const auto &samples = getRegisterSamples();
+	size_t		i		= 0;
+
+	for (auto _ : state) {
+		Reg reg{samples[i++ & 0xFFu]};
+		benchmark::DoNotOptimize(reg);
+		Register encoded = Register(reg);
+		benchmark::DoNotOptimize(encoded);
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK_TEMPLATE(BM_RegDecode, SM72445::Reg0);
+BENCHMARK_TEMPLATE(BM_RegDecode, SM72445::Reg1);
+BENCHMARK_TEMPLATE(BM_RegDecode, SM72445::Reg3);
+BENCHMARK_TEMPLATE(BM_RegDecode, SM72445::Reg4);
+BENCHMARK_TEMPLATE(BM_RegDecode, SM72445::Reg5);
+
+// Encoding is measured as a decode/encode round trip.
+BENCHMARK_TEMPLATE(BM_RegEncode, SM72445::Reg0);
+BENCHMARK_TEMPLATE(BM_RegEncode, SM72445::Reg1);
+BENCHMARK_TEMPLATE(BM_RegEncode, SM72445::Reg3);
+BENCHMARK_TEMPLATE(BM_RegEncode, SM72445::Reg4);
+BENCHMARK_TEMPLATE(BM_RegEncode, SM72445::Reg5);
+
+static void BM_Reg1Index(benchmark::State &state) {
+	const auto &samples = getRegisterSamples();
+	size_t		i		= 0;
+
+	for (auto _ : state) {
+		const SM72445::Reg1 reg1{samples[i++ & 0xFFu]};
+		uint16_t			sum = reg1[SM72445::ElectricalProperty::CURRENT_IN]
+					+ reg1[SM72445::ElectricalProperty::VOLTAGE_IN]
+					+ reg1[SM72445::ElectricalProperty::CURRENT_OUT]
+					+ reg1[SM72445::ElectricalProperty::VOLTAGE_OUT];
+		benchmark::DoNotOptimize(sum);
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Reg1Index);
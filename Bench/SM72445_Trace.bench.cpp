@@ -0,0 +1,68 @@
+/**
+ ******************************************************************************
+ * @file			: SM72445_Trace.bench.cpp
+ * @brief			: Benchmarks for trace event recording.
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "SM72445.bench.hpp"
+
+#include "SM72445_TraceRecorder.hpp"
+
+static constexpr size_t TRACE_EVENTS = 1u << 20u;
+
+static void BM_TraceRecord(benchmark::State &state) {
+	TraceRecorder recorder{TRACE_EVENTS + 1u};
+	recorder.record("warm-up", TraceRecorder::Phase::BEGIN); // Allocates this thread's buffer.
+
+	for (auto _ : state) recorder.record("event", TraceRecorder::Phase::BEGIN);
+
+	state.counters["dropped"] = double(recorder.getDroppedCount());
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_TraceRecord)->Iterations(TRACE_EVENTS); // Never overflow the buffer.
+
+static constexpr size_t THREAD_EVENTS = 1u << 18u; // Per thread, as every thread records.
+
+static TraceRecorder *sharedRecorder = nullptr;
+
+/**
+ * @brief Record from several threads into one recorder, as a multi-bus poll would.
+ */
+static void BM_TraceRecordThreaded(benchmark::State &state) {
+	if (state.thread_index() == 0) sharedRecorder = new TraceRecorder{THREAD_EVENTS + 1u};
+
+	for (auto _ : state) sharedRecorder->record("event", TraceRecorder::Phase::BEGIN);
+
+	if (state.thread_index() == 0) {
+		state.counters["dropped"] = double(sharedRecorder->getDroppedCount());
+		delete sharedRecorder;
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_TraceRecordThreaded)->Iterations(THREAD_EVENTS)->ThreadRange(1, 8);
+
+#ifdef SM72445_TRACE
+/**
+ * @brief Hit a driver trace point from several threads, through the installed hook.
+ */
+static void BM_TraceHookThreaded(benchmark::State &state) {
+	if (state.thread_index() == 0) {
+		sharedRecorder = new TraceRecorder{2u * THREAD_EVENTS + 1u};
+		sharedRecorder->install();
+	}
+
+	for (auto _ : state) {
+		SM72445_TRACE_SCOPE("scope"); // Records BEGIN and END.
+	}
+
+	if (state.thread_index() == 0) {
+		state.counters["dropped"] = double(sharedRecorder->getDroppedCount());
+		sharedRecorder->uninstall();
+		delete sharedRecorder;
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_TraceHookThreaded)->Iterations(THREAD_EVENTS)->ThreadRange(1, 8);
+#endif
@@ -0,0 +1,55 @@
+/**
+ ******************************************************************************
+ * @file			: SM72445_Transport.bench.cpp
+ * @brief			: Benchmarks for FramedI2C frame encoding and decoding.
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "SM72445.bench.hpp"
+
+#include "SM72445_Transport.hpp"
+
+using Register = SM72445::Register;
+
+/**
+ * @brief The register samples as received frames, ready to decode.
+ */
+static array<uint8_t, 256u * FramedI2C::FRAME_SIZE> getFrameSamples(void) {
+	array<uint8_t, 256u * FramedI2C::FRAME_SIZE> frames{};
+	const auto									&samples = getRegisterSamples();
+	for (size_t i = 0; i < samples.size(); i++) {
+		FramedI2C::encode(
+			samples[i],
+			ByteSpan{frames.data() + i * FramedI2C::FRAME_SIZE, FramedI2C::FRAME_SIZE}
+		);
+	}
+	return frames;
+}
+
+static void BM_FrameDecode(benchmark::State &state) {
+	auto   frames = getFrameSamples();
+	size_t i	  = 0;
+
+	for (auto _ : state) {
+		uint8_t *frame = frames.data() + (i++ & 0xFFu) * FramedI2C::FRAME_SIZE;
+		auto	 reg   = FramedI2C::decode(ByteSpan{frame, FramedI2C::FRAME_SIZE});
+		benchmark::DoNotOptimize(reg);
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_FrameDecode);
+
+static void BM_FrameEncode(benchmark::State &state) {
+	const auto &samples = getRegisterSamples();
+	size_t		i		= 0;
+
+	alignas(uint64_t) uint8_t frame[FramedI2C::FRAME_SIZE];
+	for (auto _ : state) {
+		FramedI2C::encode(samples[i++ & 0xFFu], ByteSpan{frame, FramedI2C::FRAME_SIZE});
+		benchmark::DoNotOptimize(frame);
+		benchmark::ClobberMemory();
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_FrameEncode);
@@ -0,0 +1,98 @@
+/**
+ ******************************************************************************
+ * @file			: SM72445_X.bench.cpp
+ * @brief			: Benchmarks for SM72445_X conversions and the ConfigBuilder.
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "SM72445.bench.hpp"
+
+using DeviceAddress = SM72445::DeviceAddress;
+using MemoryAddress = SM72445::MemoryAddress;
+using PanelMode		= SM72445_X::Config::PanelMode;
+using DeadTime		= SM72445_X::Config::DeadTime;
+
+class SM72445_X_Bench : public benchmark::Fixture {
+public:
+	FakeI2C	  i2c{};
+	SM72445_X sm72445{i2c, DeviceAddress::ADDR001, .1f, .2f, .3f, .4f};
+
+	void SetUp(const benchmark::State &) override {
+		i2c.registers = {};
+		i2c.registers[static_cast<uint8_t>(MemoryAddress::REG1) & 0x7u] =
+			0x0123'4567'89AB'CDEFull;
+	}
+};
+
+BENCHMARK_F(SM72445_X_Bench, convertAdcResultToPinVoltage)(benchmark::State &state) {
+	uint16_t adcResult = 0u;
+
+	for (auto _ : state) {
+		float voltage = sm72445.convertAdcResultToPinVoltage(adcResult++ & 0x3FFu, 10u);
+		benchmark::DoNotOptimize(voltage);
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK_F(SM72445_X_Bench, getElectricalMeasurementsRegister)(benchmark::State &state) {
+	for (auto _ : state) {
+		auto reg1 = sm72445.getElectricalMeasurementsRegister();
+		benchmark::DoNotOptimize(reg1);
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK_F(SM72445_X_Bench, getElectricalMeasurements)(benchmark::State &state) {
+	for (auto _ : state) {
+		auto measurements = sm72445.getElectricalMeasurements();
+		benchmark::DoNotOptimize(measurements);
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK_F(SM72445_X_Bench, convertElectricalMeasurements)(benchmark::State &state) {
+	const auto &samples = getRegisterSamples();
+	size_t		i		= 0;
+
+	for (auto _ : state) {
+		const SM72445::Reg1 reg1{samples[i++ & 0xFFu]};
+		auto				measurements = sm72445.convertElectricalMeasurements(reg1);
+		benchmark::DoNotOptimize(measurements);
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK_F(SM72445_X_Bench, getInputCurrent)(benchmark::State &state) {
+	for (auto _ : state) {
+		auto current = sm72445.getInputCurrent();
+		benchmark::DoNotOptimize(current);
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK_F(SM72445_X_Bench, configBuilderChain)(benchmark::State &state) {
+	float current = 0.0f;
+
+	for (auto _ : state) {
+		auto reg3 = sm72445.getConfigBuilder()
+						.setPanelModeOverride(PanelMode::USE_H_BRIDGE)
+						.setMaxOutputCurrentOverride(current)
+						.setMaxOutputVoltageOverride(5.0f)
+						.setDeadTimeOnTimeOverride(DeadTime::TWO)
+						.build();
+		benchmark::DoNotOptimize(reg3);
+		current = current < 10.0f ? current + 0.01f : 0.0f;
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK_F(SM72445_X_Bench, configBuilderFetchModifyWrite)(benchmark::State &state) {
+	for (auto _ : state) {
+		auto written = sm72445.setConfig(
+			sm72445.getConfigBuilder(true).setMaxOutputCurrentOverride(2.0f).build()
+		);
+		benchmark::DoNotOptimize(written);
+	}
+	state.SetItemsProcessed(state.iterations());
+}
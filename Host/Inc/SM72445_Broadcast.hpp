@@ -0,0 +1,91 @@
+/**
+ ******************************************************************************
+ * @file			: SM72445_Broadcast.hpp
+ * @brief			: Fleet-wide configuration broadcast across many I2C buses.
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#pragma once
+
+#include <exception>
+#include <functional>
+#include <vector>
+
+#include "SM72445_BusWorkers.hpp"
+#include "SM72445_X.hpp"
+
+/**
+ * @brief Writes a configuration to every device of a fleet, in parallel across buses.
+ *
+ * @details
+ * Each bus is served by its own persistent BusWorkers thread, which writes REG3 of the
+ * bus's devices back-to-back with no other work in between. A broadcast therefore takes
+ * about as long as the slowest bus, rather than the sum of all buses, and creates no
+ * threads.
+ *
+ * Per-device images (e.g. calibration-aware ConfigBuilder results) are all computed
+ * before a bus's first write, so that computation does not delay the writes.
+ *
+ * @note Devices on different buses must not share an I2C instance, unless that instance
+ * is itself thread-safe.
+ */
+class ConfigBroadcast {
+public:
+	using Register		 = SM72445::Register;
+	using ConfigRegister = SM72445::ConfigRegister;
+
+	using Bus	= std::vector<const SM72445_X *>; // Devices sharing one I2C bus.
+	using Image = std::function<ConfigRegister(const SM72445_X &)>;
+
+	/**
+	 * @brief The outcome of a broadcast.
+	 */
+	struct Report {
+		// The value written to each device, or nullopt on failure. Indexed [bus][device].
+		std::vector<std::vector<optional<Register>>> written;
+
+		// The exception which stopped a bus, or nullptr. Indexed [bus]. Devices of the bus
+		// not yet written are reported as failed.
+		std::vector<std::exception_ptr> errors;
+
+		size_t succeeded;
+		size_t failed;
+	};
+
+private:
+	const std::vector<Bus> buses;
+	mutable BusWorkers	   workers;
+
+public:
+	/**
+	 * @brief Construct a new Config Broadcast.
+	 *
+	 * @param buses The fleet, grouped by I2C bus. The devices must outlive the broadcast.
+	 * @throws std::system_error If the bus threads cannot be created.
+	 */
+	explicit ConfigBroadcast(std::vector<Bus> buses);
+
+	/**
+	 * @brief Write the same configuration to every device.
+	 *
+	 * @param configRegister The precomputed configuration, e.g. from a ConfigBuilder.
+	 * @return The per-device results.
+	 * @note Concurrent broadcasts are run one after the other.
+	 */
+	Report broadcast(ConfigRegister configRegister) const;
+
+	/**
+	 * @brief Write a per-device configuration to every device.
+	 *
+	 * @param image Computes each device's configuration. Called concurrently from the
+	 * bus threads, so must be safe to do so.
+	 * @return The per-device results.
+	 */
+	Report broadcast(const Image &image) const;
+
+	/**
+	 * @brief Get the number of devices across all buses.
+	 */
+	size_t getDeviceCount(void) const;
+};
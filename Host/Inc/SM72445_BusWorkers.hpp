@@ -0,0 +1,80 @@
+/**
+ ******************************************************************************
+ * @file			: SM72445_BusWorkers.hpp
+ * @brief			: Persistent per-bus worker threads for fleet-wide operations.
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Runs one task per I2C bus in parallel, on threads that persist between runs.
+ *
+ * @details
+ * The calling thread serves bus 0 and a worker thread serves each other bus, so a single
+ * bus uses no threads at all. Workers are created once, with the object, and sleep
+ * between runs, so a run costs a wake-up per bus rather than a thread creation.
+ *
+ * An exception thrown by a bus's task is caught on the thread that ran it and returned
+ * from run(), after every bus has finished. Exceptions never escape a worker.
+ */
+class BusWorkers {
+public:
+	using Task = std::function<void(size_t bus)>;
+
+private:
+	const size_t busCount;
+
+	std::mutex				runMutex; // Serialises runs.
+	std::mutex				mutex;
+	std::condition_variable wake;
+	std::condition_variable done;
+
+	const Task						*task;
+	uint64_t						 generation; // Incremented to start each run.
+	size_t							 pending;	 // Workers yet to finish the current run.
+	bool							 stopping;
+	std::vector<std::exception_ptr> *errors;
+
+	std::vector<std::thread> workers;
+
+public:
+	/**
+	 * @brief Construct the workers for a number of buses.
+	 *
+	 * @param busCount The number of buses. busCount - 1 threads are created.
+	 * @throws std::system_error If a thread cannot be created. Threads already created
+	 * are stopped and joined first.
+	 */
+	explicit BusWorkers(size_t busCount);
+	~BusWorkers();
+
+	BusWorkers(const BusWorkers &) = delete;
+
+	/**
+	 * @brief Run a task for every bus in parallel, returning once all have finished.
+	 *
+	 * @param task Called once per bus, with the bus index, from that bus's thread.
+	 * @return The exception thrown by each bus's task, or nullptr. Indexed by bus.
+	 * @note Concurrent calls are run one after the other.
+	 */
+	std::vector<std::exception_ptr> run(const Task &task);
+
+	/**
+	 * @brief Get the number of buses served.
+	 */
+	size_t getBusCount(void) const;
+
+private:
+	void serve(size_t bus);
+	void stop(void);
+};
@@ -0,0 +1,142 @@
+/**
+ ******************************************************************************
+ * @file			: SM72445_CalibrationPublisher.hpp
+ * @brief			: Calibration publishing with epoch-based reclamation.
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#pragma once
+
+#include <atomic>
+#include <mutex>
+#include <unordered_set>
+#include <vector>
+
+#include "SM72445_X.hpp"
+
+/**
+ * @brief Publishes calibrations to live devices, and frees each replaced calibration
+ * block once no conversion can still be reading it.
+ *
+ * @details
+ * SM72445_X::setCalibration() swaps a device's calibration block without pausing
+ * conversions, so a replaced block may still be read by a conversion in progress on
+ * another thread. The publisher owns the blocks it publishes and retires those replaced,
+ * reclaiming them by epoch as DeviceRegistry reclaims snapshots: each publication
+ * advances a global epoch, each poll thread pins the epoch it starts a cycle in through
+ * its Reader, and a block retired in an epoch is freed once no reader remains pinned
+ * from that epoch or earlier. Reclamation is performed by the publishing thread, never
+ * by poll threads.
+ *
+ * @note Publications are serialised by a mutex, which poll threads never take. Every
+ * publication to a device must go through the same publisher.
+ */
+class CalibrationPublisher {
+public:
+	using Calibration = SM72445_X::Calibration;
+
+	static constexpr size_t MAX_READERS = 64u;
+
+private:
+	struct alignas(64) ReaderSlot { // One cache line each, so pins do not contend.
+		std::atomic<bool>	  claimed{false};
+		std::atomic<uint64_t> epoch{0u}; // The epoch of the current pin, or 0 if none.
+	};
+
+	struct Retired {
+		const Calibration *block;
+		uint64_t		   epoch;
+	};
+
+public:
+	/**
+	 * @brief Keeps every calibration block loaded while it exists valid until destroyed.
+	 */
+	class Guard {
+		friend class CalibrationPublisher;
+
+		std::atomic<uint64_t> *slot;
+
+		explicit Guard(std::atomic<uint64_t> &slot);
+
+	public:
+		Guard(Guard &&other) noexcept;
+		Guard(const Guard &) = delete;
+		~Guard();
+	};
+
+	/**
+	 * @brief A poll thread's handle for pinning calibrations.
+	 *
+	 * @note A reader must be used by one thread at a time, holding at most one Guard.
+	 */
+	class Reader {
+		friend class CalibrationPublisher;
+
+		CalibrationPublisher *publisher;
+		ReaderSlot			 *slot;
+
+		Reader(CalibrationPublisher &publisher, ReaderSlot &slot);
+
+	public:
+		Reader(Reader &&other) noexcept;
+		Reader(const Reader &) = delete;
+		~Reader();
+
+		/**
+		 * @brief Pin the calibrations of every device, e.g. for one poll cycle. Lock-free
+		 * and allocation-free.
+		 */
+		Guard pin(void) const;
+	};
+
+private:
+	std::atomic<uint64_t>		   epoch;
+	array<ReaderSlot, MAX_READERS> slots;
+
+	std::mutex								mutex;	// Serialises publications.
+	std::unordered_set<const Calibration *> blocks; // Owned, and possibly published.
+	std::vector<Retired>					retired;
+
+public:
+	CalibrationPublisher();
+
+	CalibrationPublisher(const CalibrationPublisher &) = delete;
+
+	/**
+	 * @brief Destroy the publisher, freeing every block it owns. Every Reader must have
+	 * been destroyed, and every device published to destroyed or restored.
+	 */
+	~CalibrationPublisher();
+
+	/**
+	 * @brief Claim a reader for a poll thread.
+	 *
+	 * @return The reader, or nullopt if MAX_READERS are in use.
+	 */
+	optional<Reader> addReader(void);
+
+	/**
+	 * @brief Publish a copy of a calibration to a device, retiring the block it replaces
+	 * if this publisher published it.
+	 */
+	void publish(SM72445_X &device, const Calibration &calibration);
+
+	/**
+	 * @brief Restore the calibration given at the device's construction, retiring the
+	 * block it replaces if this publisher published it.
+	 */
+	void restore(SM72445_X &device);
+
+	/**
+	 * @brief Free retired blocks no longer pinned. Publications also do so.
+	 *
+	 * @return The number of retired blocks still pinned.
+	 */
+	size_t reclaim(void);
+
+private:
+	void   retire(const Calibration *previous);
+	size_t reclaimRetired(void);
+};
@@ -0,0 +1,248 @@
+/**
+ ******************************************************************************
+ * @file			: SM72445_ControlLoop.hpp
+ * @brief			: Fixed-period control loop executor with timing statistics.
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <vector>
+
+#include "SM72445_Instrumented.hpp"
+#include "SM72445_X.hpp"
+
+/**
+ * @brief Runs a callback against a set of devices at a fixed period, recording wake-up
+ * jitter, execution time and deadline misses.
+ *
+ * @details
+ * Cycles are released at absolute deadlines on CLOCK_MONOTONIC (clock_nanosleep with
+ * TIMER_ABSTIME), so time spent in the callback and sleep overshoot do not accumulate
+ * as drift. A cycle finishing after the next deadline is a miss; deadlines that have
+ * already passed are then skipped rather than run back-to-back, keeping the loop's phase.
+ *
+ * Work that may be dropped under load (e.g. REG0 or REG4 reads) should be wrapped in
+ * Cycle::runNonCritical(), which sheds it once the cycle is later than the shedding
+ * threshold.
+ *
+ * Jitter and execution times are held in the same log-linear histograms as
+ * InstrumentedI2C, giving quantiles within 25% of their true values. Statistics are
+ * published through relaxed atomics, so the loop never waits on a thread reading them.
+ */
+class ControlLoop {
+public:
+	using Devices = std::vector<const SM72445_X *>;
+
+	class Cycle;
+	using Callback = std::function<void(Cycle &cycle)>;
+
+	/**
+	 * @brief The time source of a loop. May be replaced, e.g. to simulate timing in tests.
+	 */
+	class Clock {
+	public:
+		virtual ~Clock() = default;
+
+		/**
+		 * @brief Get the current time, in nanoseconds.
+		 */
+		virtual uint64_t now(void) = 0;
+
+		/**
+		 * @brief Block until the given absolute time, in nanoseconds.
+		 */
+		virtual void sleepUntil(uint64_t deadline) = 0;
+	};
+
+	/**
+	 * @brief Timing statistics over all cycles run since construction or reset.
+	 */
+	struct Stats {
+		using Histogram = array<uint64_t, InstrumentedI2C::BUCKETS>;
+
+		uint64_t cycles;
+		uint64_t misses;  // Cycles finishing after the next deadline.
+		uint64_t skipped; // Deadlines skipped after misses.
+		uint64_t shed;	  // Non-critical work items shed.
+
+		uint64_t maxJitter;	   // Nanoseconds from deadline to wake-up.
+		uint64_t maxExecution; // Nanoseconds from wake-up to callback return.
+
+		Histogram jitter;
+		Histogram execution;
+
+		/**
+		 * @brief Get the jitter below which the given fraction of cycles woke.
+		 *
+		 * @param quantile The fraction, e.g. 0.99f.
+		 * @return The upper bound in nanoseconds, or zero if no cycles were run.
+		 */
+		uint64_t getJitterQuantile(float quantile) const;
+
+		/**
+		 * @brief Get the execution time below which the given fraction of cycles ran.
+		 *
+		 * @param quantile The fraction, e.g. 0.99f.
+		 * @return The upper bound in nanoseconds, or zero if no cycles were run.
+		 */
+		uint64_t getExecutionQuantile(float quantile) const;
+	};
+
+private:
+	using Counter = std::atomic<uint64_t>;
+
+	/**
+	 * @brief The live counterpart of Stats, written only by the loop's thread.
+	 */
+	struct Counters {
+		Counter cycles;
+		Counter misses;
+		Counter skipped;
+		Counter shed;
+		Counter maxJitter;
+		Counter maxExecution;
+
+		array<Counter, InstrumentedI2C::BUCKETS> jitter;
+		array<Counter, InstrumentedI2C::BUCKETS> execution;
+	};
+
+	const Devices  devices;
+	const uint64_t period;
+	const uint64_t shedAfter;
+	const Callback callback;
+	Clock		  &clock;
+
+	std::atomic<bool> stopping;
+	uint64_t		  index;
+
+	Counters counters;
+
+public:
+	/**
+	 * @brief Construct a new Control Loop.
+	 *
+	 * @param devices The devices passed to each cycle. They must outlive the loop.
+	 * @param period The cycle period, in nanoseconds.
+	 * @param callback The work of each cycle.
+	 * @param shedAfter The lateness, in nanoseconds from the cycle's deadline, after
+	 * which non-critical work is shed. Defaults to half the period.
+	 * @param clock The time source. Defaults to CLOCK_MONOTONIC. Must outlive the loop.
+	 */
+	ControlLoop(
+		Devices	 devices,
+		uint64_t period,
+		Callback callback,
+		uint64_t shedAfter = 0u,
+		Clock	&clock	   = getMonotonicClock()
+	);
+
+	ControlLoop(const ControlLoop &) = delete;
+
+	/**
+	 * @brief Run cycles on the calling thread, the first released immediately.
+	 *
+	 * @param cycles The number of cycles to run, or zero to run until stopped.
+	 * @return The number of cycles run.
+	 */
+	uint64_t run(uint64_t cycles = 0u);
+
+	/**
+	 * @brief Stop a running loop after its current cycle. May be called from the
+	 * callback or any other thread. If the loop is not running, the next run() returns
+	 * without running any cycles.
+	 */
+	void stop(void);
+
+	/**
+	 * @brief Get a snapshot of the timing statistics. May be called while running, in
+	 * which case fields may be from adjacent cycles.
+	 */
+	Stats getStats(void) const;
+
+	/**
+	 * @brief Reset the timing statistics. May be called while running.
+	 */
+	void resetStats(void);
+
+	/**
+	 * @brief Get the cycle period, in nanoseconds.
+	 */
+	uint64_t getPeriod(void) const;
+
+	/**
+	 * @brief Get the current CLOCK_MONOTONIC time, in nanoseconds.
+	 */
+	static uint64_t getTime(void);
+
+	/**
+	 * @brief Get the CLOCK_MONOTONIC time source used by default.
+	 */
+	static Clock &getMonotonicClock(void);
+
+private:
+	void record(const Cycle &cycle, uint64_t execution, uint64_t skipped);
+};
+
+/**
+ * @brief A single cycle of a ControlLoop, passed to its callback.
+ */
+class ControlLoop::Cycle {
+	const ControlLoop &loop;
+	const uint64_t	   index;
+	const uint64_t	   deadline;
+	const uint64_t	   jitter;
+	uint64_t		   shed;
+
+public:
+	/**
+	 * @brief Get the number of this cycle, counted from the first run.
+	 */
+	uint64_t getIndex(void) const { return this->index; }
+
+	/**
+	 * @brief Get the time at which this cycle was due, in nanoseconds of the loop's clock.
+	 */
+	uint64_t getDeadline(void) const { return this->deadline; }
+
+	/**
+	 * @brief Get the time from this cycle's deadline to its wake-up, in nanoseconds.
+	 */
+	uint64_t getJitter(void) const { return this->jitter; }
+
+	/**
+	 * @brief Get the devices of the loop.
+	 */
+	const Devices &getDevices(void) const { return this->loop.devices; }
+
+	/**
+	 * @brief Check whether this cycle is late enough for non-critical work to be shed.
+	 */
+	bool isLate(void) const {
+		return this->loop.clock.now() - this->deadline > this->loop.shedAfter;
+	}
+
+	/**
+	 * @brief Run non-critical work, unless this cycle is late.
+	 *
+	 * @param work The work to run.
+	 * @return true if the work was run, false if it was shed.
+	 */
+	template <typename Work>
+	bool runNonCritical(Work &&work) {
+		if (isLate()) {
+			this->shed++;
+			return false;
+		}
+		work();
+		return true;
+	}
+
+private:
+	friend class ControlLoop;
+	Cycle(const ControlLoop &loop, uint64_t index, uint64_t deadline, uint64_t jitter)
+		: loop{loop}, index{index}, deadline{deadline}, jitter{jitter}, shed{0u} {}
+};
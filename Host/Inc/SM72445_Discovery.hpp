@@ -0,0 +1,97 @@
+/**
+ ******************************************************************************
+ * @file			: SM72445_Discovery.hpp
+ * @brief			: Parallel discovery of SM72445 devices across many I2C buses.
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#pragma once
+
+#include <vector>
+
+#include "SM72445_X.hpp"
+
+/**
+ * @brief Finds the SM72445 devices on a set of I2C buses and reads their initial
+ * register images, in parallel across buses.
+ *
+ * @details
+ * Every DeviceAddress is probed by reading REG0. Each device that responds then has
+ * REG3, REG4 and REG5 read, giving its analogue channel strapping and its configuration,
+ * offsets and thresholds.
+ *
+ * Probes of empty addresses usually cost a full transport timeout, which dominates
+ * discovery time. Each bus may therefore provide a separate probe I2C, typically the
+ * same bus configured with a much shorter timeout or fewer retries than normal. Only
+ * the REG0 probes use it.
+ *
+ * Each bus is served by its own BusWorkers thread, so discovery takes about as long as
+ * the slowest bus rather than the sum of all buses.
+ *
+ * @note Buses must not share an I2C instance, unless that instance is itself
+ * thread-safe.
+ */
+class DeviceDiscovery {
+public:
+	using I2C			= SM72445::I2C;
+	using Register		= SM72445::Register;
+	using DeviceAddress = SM72445::DeviceAddress;
+
+	static constexpr array<DeviceAddress, 7> ADDRESSES = {
+		DeviceAddress::ADDR001,
+		DeviceAddress::ADDR010,
+		DeviceAddress::ADDR011,
+		DeviceAddress::ADDR100,
+		DeviceAddress::ADDR101,
+		DeviceAddress::ADDR110,
+		DeviceAddress::ADDR111,
+	};
+
+	/**
+	 * @brief The transports of one I2C bus.
+	 */
+	struct Bus {
+		I2C *i2c;			  // Used to read the register images.
+		I2C *probe = nullptr; // Used to probe for devices, or nullptr to use i2c.
+	};
+
+	/**
+	 * @brief A discovered device and its initial register images.
+	 */
+	struct Device {
+		size_t			   bus; // Index into the buses given to the constructor.
+		DeviceAddress	   deviceAddress;
+		Register		   reg0; // The probe response.
+		optional<Register> reg3;
+		optional<Register> reg4;
+		optional<Register> reg5;
+
+		/**
+		 * @brief Check whether all register images were read.
+		 */
+		bool isComplete(void) const;
+	};
+
+	using Table = std::vector<Device>; // Ordered by bus, then by address.
+
+private:
+	const std::vector<Bus> buses;
+
+public:
+	/**
+	 * @brief Construct a new Device Discovery.
+	 *
+	 * @param buses The buses to search. The transports must outlive the discovery.
+	 */
+	explicit DeviceDiscovery(std::vector<Bus> buses);
+
+	/**
+	 * @brief Probe every address on every bus.
+	 *
+	 * @return The devices found.
+	 * @throws The exception thrown by the lowest-indexed bus whose transport threw, once
+	 * every bus has finished. std::system_error if the bus threads cannot be created.
+	 */
+	Table discover(void) const;
+};
@@ -0,0 +1,113 @@
+/**
+ ******************************************************************************
+ * @file			: SM72445_FleetKernels.hpp
+ * @brief			: Vectorised fleet power, efficiency and ranking kernels.
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#pragma once
+
+#include "SM72445_FleetState.hpp"
+
+/**
+ * @brief Computes per-device power and efficiency, plant totals and the best and worst
+ * performing devices of a fleet in a single pass over FleetState's arrays.
+ *
+ * @details
+ * For each device, counts are scaled to physical units and
+ *   pIn = vIn * iIn,  pOut = vOut * iOut,  efficiency = pOut / pIn.
+ *
+ * The pass runs eight devices at a time with AVX2 on x86-64 CPUs that support it, four
+ * at a time with NEON on AArch64, and one at a time otherwise. Ranking is kept in the
+ * same pass by comparing each block against the current k-th best and worst efficiency
+ * and only inserting the rare candidates that beat them.
+ *
+ * Only devices with the FleetState::VALID flag contribute; all other devices produce
+ * zeros. Devices whose input power is zero (e.g. at night) have an efficiency of zero
+ * and are not ranked.
+ *
+ * Per-device outputs and totals match to within floating-point summation order across
+ * instruction sets, and rankings match exactly.
+ */
+class FleetKernels {
+public:
+	using DeviceId = FleetState::DeviceId;
+
+	enum class InstructionSet : uint8_t {
+		SCALAR = 0x0u,
+		AVX2   = 0x1u,
+		NEON   = 0x2u,
+	};
+
+	/**
+	 * @brief A ranked device.
+	 */
+	struct Ranking {
+		DeviceId id;
+		float	 efficiency;
+	};
+
+	/**
+	 * @brief Optional destinations for per-device values and rankings. Any null pointer
+	 * skips that output.
+	 */
+	struct Outputs {
+		float *powerIn	  = nullptr; // One value per device, in Watts.
+		float *powerOut	  = nullptr; // One value per device, in Watts.
+		float *efficiency = nullptr; // One value per device, as a fraction.
+
+		Ranking *top	= nullptr; // Up to k most efficient devices, best first.
+		Ranking *bottom = nullptr; // Up to k least efficient devices, worst first.
+		size_t	 k		= 0u;
+	};
+
+	/**
+	 * @brief Plant-level totals of one pass.
+	 */
+	struct Summary {
+		double powerIn;	 // Total input power, in Watts.
+		double powerOut; // Total output power, in Watts.
+		size_t devices;	 // Devices contributing to the totals.
+		size_t ranked;	 // Entries written to each of top and bottom.
+
+		/**
+		 * @brief Get the plant efficiency, or zero if there is no input power.
+		 */
+		float getEfficiency(void) const;
+	};
+
+	FleetKernels() = delete;
+
+	/**
+	 * @brief Run the kernel over a fleet.
+	 *
+	 * @param columns The fleet's arrays, from FleetState::getColumns().
+	 * @param outputs Destinations for per-device values and rankings.
+	 * @return The plant totals.
+	 */
+	static Summary evaluate(const FleetState::Columns &columns, const Outputs &outputs);
+
+	/**
+	 * @brief Run the kernel over a fleet.
+	 */
+	static Summary evaluate(const FleetState &fleet, const Outputs &outputs);
+
+	/**
+	 * @brief Get the instruction set used by evaluate().
+	 */
+	static InstructionSet getInstructionSet(void);
+
+	/**
+	 * @brief Select the instruction set used by evaluate(), e.g. to compare against the
+	 * scalar kernel. The best supported instruction set is selected by default.
+	 *
+	 * @return True if the instruction set is supported by this build and CPU.
+	 */
+	static bool setInstructionSet(InstructionSet instructionSet);
+
+	/**
+	 * @brief Check whether an instruction set is supported by this build and CPU.
+	 */
+	static bool isSupported(InstructionSet instructionSet);
+};
@@ -0,0 +1,153 @@
+/**
+ ******************************************************************************
+ * @file			: SM72445_FleetState.hpp
+ * @brief			: Structure-of-arrays store of the latest state of a device fleet.
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "SM72445_X.hpp"
+
+/**
+ * @brief Holds the latest raw REG1 counts, calibration and status of every device in a
+ * fleet in contiguous per-field arrays, indexed by a dense device id.
+ *
+ * @details
+ * Each electrical property has its own array of raw 10-bit counts and its own array of
+ * scale factors (physical units per count), so fleet-wide calculations run as tight,
+ * vectorisable loops over a few contiguous arrays rather than across scattered device
+ * objects. Scale factors are derived from each device when it is added, and reproduce
+ * SM72445_X::convertElectricalMeasurements(). When a device's calibration is replaced
+ * with SM72445_X::setCalibration(), poll() refreshes its scales before storing the next
+ * sample; if samples are stored with update() instead, call updateScales(). If replaced
+ * blocks are reclaimed, e.g. by a CalibrationPublisher, poll while pinned.
+ *
+ * A failed poll sets the FAILED flag but keeps the device's last good counts.
+ *
+ * @note Not thread-safe. Poll and compute from one thread, or serialise externally.
+ */
+class FleetState {
+public:
+	using DeviceId			 = uint32_t;
+	using ElectricalProperty = SM72445::ElectricalProperty;
+
+	static constexpr size_t PROPERTIES = 4u;
+
+	// Status flags.
+	static constexpr uint8_t VALID	= 0x1u; // Counts hold at least one good sample.
+	static constexpr uint8_t FAILED = 0x2u; // The latest poll failed.
+
+	/**
+	 * @brief Pointers to the per-property arrays, indexed by ElectricalProperty. Valid
+	 * until the next device is added.
+	 */
+	struct Columns {
+		array<const uint16_t *, PROPERTIES> counts;
+		array<const float *, PROPERTIES>	scales;
+		const uint8_t					   *status;
+		size_t								size;
+	};
+
+private:
+	std::vector<const SM72445_X *> devices;
+
+	// The calibration from which each device's scales were derived. Compared by value, as
+	// a replacement block may be allocated where a freed one was.
+	std::vector<SM72445_X::Calibration> calibrations;
+
+	array<std::vector<uint16_t>, PROPERTIES> counts;
+	array<std::vector<float>, PROPERTIES>	 scales;
+	std::vector<uint8_t>					 status;
+
+public:
+	FleetState() = default;
+
+	FleetState(const FleetState &) = delete;
+
+	/**
+	 * @brief Reserve storage for a number of devices, avoiding reallocation while adding.
+	 */
+	void reserve(size_t devices);
+
+	/**
+	 * @brief Add a device to the fleet.
+	 *
+	 * @param device The device. It must outlive the FleetState if poll() is used.
+	 * @return The dense id of the device, equal to the number of devices added before it.
+	 * @note A device that cannot convert measurements (i.e. has a zero gain) has zero
+	 * scales, so its measurements convert to zero.
+	 */
+	DeviceId add(const SM72445_X &device);
+
+	/**
+	 * @brief Re-derive the scale factors of a device from its current calibration.
+	 */
+	void updateScales(DeviceId id);
+
+	/**
+	 * @brief Get the number of devices in the fleet.
+	 */
+	size_t size(void) const;
+
+	/**
+	 * @brief Store a REG1 sample, or record a failed poll, for one device.
+	 */
+	void update(DeviceId id, const optional<SM72445::Reg1> &reg1);
+
+	/**
+	 * @brief Store REG1 samples for a contiguous range of devices.
+	 *
+	 * @param first The id of the device of the first sample.
+	 * @param samples The samples, nullopt marking a failed poll.
+	 * @param count The number of samples. The range is clipped to the fleet.
+	 */
+	void update(DeviceId first, const optional<SM72445::Reg1> *samples, size_t count);
+
+	/**
+	 * @brief Read REG1 from a contiguous range of devices and store the results,
+	 * refreshing the scales of any device whose calibration has been replaced.
+	 *
+	 * @param first The id of the first device to poll.
+	 * @param count The number of devices to poll. The range is clipped to the fleet.
+	 * @return The number of successful reads.
+	 */
+	size_t poll(DeviceId first, size_t count);
+
+	/**
+	 * @brief Convert the counts of one property of a range of devices to physical units.
+	 *
+	 * @param property The electrical property to convert.
+	 * @param out Receives one value per device, in Amps or Volts.
+	 * @param first The id of the first device to convert.
+	 * @param count The number of devices to convert. The range is clipped to the fleet.
+	 */
+	void convert(
+		ElectricalProperty property,
+		float			  *out,
+		DeviceId		   first = 0u,
+		size_t			   count = SIZE_MAX
+	) const;
+
+	/**
+	 * @brief Get the raw counts of a device.
+	 */
+	SM72445::Reg1 getCounts(DeviceId id) const;
+
+	/**
+	 * @brief Get the status flags of a device.
+	 */
+	uint8_t getStatus(DeviceId id) const;
+
+	/**
+	 * @brief Get the per-property arrays, e.g. for FleetKernels.
+	 */
+	Columns getColumns(void) const;
+
+private:
+	size_t clip(DeviceId first, size_t count) const;
+};
@@ -0,0 +1,107 @@
+/**
+ ******************************************************************************
+ * @file			: SM72445_Flyweight.hpp
+ * @brief			: Compact device handles sharing interned calibration profiles.
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#pragma once
+
+#include <deque>
+#include <vector>
+
+#include "SM72445_X.hpp"
+
+/**
+ * @brief A four-byte reference to a device: its address, and its bus and calibration
+ * profile as indices into a DeviceDirectory.
+ */
+struct DeviceHandle {
+	uint8_t				   bus;
+	SM72445::DeviceAddress deviceAddress;
+	uint16_t			   profile;
+};
+
+/**
+ * @brief Resolves DeviceHandles against a shared table of buses and interned calibration
+ * profiles.
+ *
+ * @details
+ * Large fleets typically use a handful of hardware revisions, each with its own
+ * calibration. Storing a DeviceHandle per device instead of an SM72445_X shares each
+ * calibration between all the devices using it, and keeps the profiles compact and hot
+ * in cache.
+ *
+ * The full SM72445_X API is available by resolving a handle, which constructs the device
+ * on demand from the handle's bus and profile. Construction performs no bus operations,
+ * and the device uses the directory's interned profile rather than a copy of it.
+ *
+ * @note Not thread-safe while adding buses or profiles. Resolving handles is safe
+ * concurrently with other resolving.
+ */
+class DeviceDirectory {
+public:
+	using Profile = SM72445_X::Calibration;
+
+	static constexpr size_t MAX_BUSES	 = UINT8_MAX + 1u;
+	static constexpr size_t MAX_PROFILES = UINT16_MAX + 1u;
+
+private:
+	std::vector<SM72445::I2C *> buses;
+	std::deque<Profile>			profiles; // Never moved once interned; see resolve().
+
+public:
+	DeviceDirectory() = default;
+
+	DeviceDirectory(const DeviceDirectory &) = delete;
+
+	/**
+	 * @brief Add a bus.
+	 *
+	 * @param i2c The I2C interface of the bus. It must outlive the directory.
+	 * @return The index of the bus, or nullopt if the directory is full.
+	 */
+	optional<uint8_t> addBus(SM72445::I2C &i2c);
+
+	/**
+	 * @brief Intern a calibration profile, returning the index of an equal profile if
+	 * one was interned before.
+	 *
+	 * @return The index of the profile, or nullopt if the directory is full.
+	 */
+	optional<uint16_t> intern(const Profile &profile);
+
+	/**
+	 * @brief Make a handle for a device, interning its calibration.
+	 *
+	 * @return The handle, or nullopt if the bus does not exist or the directory is full.
+	 */
+	optional<DeviceHandle> makeHandle(
+		uint8_t				   bus,
+		SM72445::DeviceAddress deviceAddress,
+		const Profile		  &profile
+	);
+
+	/**
+	 * @brief Construct the device referred to by a handle.
+	 *
+	 * @param handle A handle made by this directory.
+	 * @return The device, or nullopt if the handle's bus or profile does not exist. The
+	 * device uses the directory's profile, so the directory must outlive it; copies of
+	 * the device own a copy of the profile instead.
+	 */
+	optional<SM72445_X> resolve(DeviceHandle handle) const;
+
+	/**
+	 * @brief Get the calibration profile of a handle made by this directory.
+	 *
+	 * @return The profile, or nullptr if the handle's bus or profile does not exist.
+	 */
+	const Profile *getProfile(DeviceHandle handle) const;
+
+	/**
+	 * @brief Get the number of interned profiles.
+	 */
+	size_t getProfileCount(void) const;
+};
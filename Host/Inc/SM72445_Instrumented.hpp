@@ -0,0 +1,141 @@
+/**
+ ******************************************************************************
+ * @file			: SM72445_Instrumented.hpp
+ * @brief			: I2C decorator recording per-register traffic and latency.
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+
+#include "SM72445.hpp"
+
+/**
+ * @brief I2C decorator counting transactions, failures, bytes and latency for every
+ * device and register on a bus.
+ *
+ * @details
+ * All counters are relaxed atomics, so the decorator adds no locks to the bus path and
+ * may be read from any thread while transactions are in flight. Latency is recorded in
+ * a log-linear histogram: values below 2^SUB_BUCKET_BITS nanoseconds have exact buckets,
+ * larger values are split into 2^SUB_BUCKET_BITS linear buckets per power of two, so
+ * every bucket is within 25% of its true value.
+ *
+ * @note Snapshots are taken counter by counter. A snapshot overlapping a transaction may
+ * therefore count the call but not yet its latency.
+ */
+class InstrumentedI2C : public SM72445::I2C {
+public:
+	using Clock = uint64_t (*)(void); // Monotonic nanoseconds.
+
+	static constexpr uint8_t SUB_BUCKET_BITS = 2u;
+	static constexpr uint8_t MAX_EXPONENT	 = 40u; // Latencies >= 2^40 ns overflow.
+
+	// Exact buckets, linear sub-buckets per power of two, then one overflow bucket.
+	static constexpr size_t BUCKETS =
+		((MAX_EXPONENT - SUB_BUCKET_BITS + 1u) << SUB_BUCKET_BITS) + 1u;
+
+	static constexpr size_t BYTES_PER_TRANSACTION = 7u; // Register payload only.
+
+	/**
+	 * @brief Counters for one device and register, or an aggregate thereof.
+	 */
+	struct Stats {
+		uint64_t				 reads;
+		uint64_t				 writes;
+		uint64_t				 failures;	  // Transactions returning nullopt.
+		uint64_t				 bytes;		  // Payload bytes of successful transactions.
+		uint64_t				 nanoseconds; // Total latency of all transactions.
+		array<uint64_t, BUCKETS> latency;	  // Log-linear histogram, see getBucket().
+
+		/**
+		 * @brief Get the total number of transactions.
+		 */
+		uint64_t getCalls(void) const;
+
+		/**
+		 * @brief Get the latency below which the given fraction of transactions fell.
+		 *
+		 * @param quantile The fraction, e.g. 0.99f.
+		 * @return The upper bound in nanoseconds of the bucket holding the quantile, or
+		 * zero if there were no transactions.
+		 */
+		uint64_t getLatencyQuantile(float quantile) const;
+
+		Stats &operator+=(const Stats &other);
+	};
+
+	/**
+	 * @brief Get the histogram bucket of a latency.
+	 */
+	static size_t getBucket(uint64_t nanoseconds);
+
+	/**
+	 * @brief Get the largest latency held by a histogram bucket.
+	 */
+	static uint64_t getBucketUpperBound(size_t bucket);
+
+private:
+	struct Cell;
+
+	SM72445::I2C			&i2c;
+	const Clock				 clock;
+	std::unique_ptr<Cell[]> cells; // Indexed by DeviceAddress, then MemoryAddress.
+
+public:
+	/**
+	 * @brief Construct a new Instrumented I2C.
+	 *
+	 * @param i2c The I2C interface to instrument.
+	 * @param clock The latency time source. Defaults to the steady clock.
+	 */
+	InstrumentedI2C(SM72445::I2C &i2c, Clock clock = nullptr);
+	virtual ~InstrumentedI2C();
+
+	InstrumentedI2C(const InstrumentedI2C &) = delete;
+
+	virtual optional<Register> read( //
+		DeviceAddress deviceAddress,
+		MemoryAddress memoryAddress
+	) override final;
+
+	virtual optional<Register> write(
+		DeviceAddress deviceAddress,
+		MemoryAddress memoryAddress,
+		Register	  data
+	) override final;
+
+	/**
+	 * @brief Get the counters of one register of one device.
+	 */
+	Stats snapshot(DeviceAddress deviceAddress, MemoryAddress memoryAddress) const;
+
+	/**
+	 * @brief Get the counters of one register, summed over all devices.
+	 */
+	Stats snapshot(MemoryAddress memoryAddress) const;
+
+	/**
+	 * @brief Get the counters of all traffic through the decorator.
+	 */
+	Stats snapshot(void) const;
+
+	/**
+	 * @brief Zero all counters.
+	 */
+	void reset(void);
+
+private:
+	Cell &getCell(DeviceAddress deviceAddress, MemoryAddress memoryAddress) const;
+
+	void record(
+		DeviceAddress deviceAddress,
+		MemoryAddress memoryAddress,
+		bool		  isWrite,
+		bool		  success,
+		uint64_t	  nanoseconds
+	);
+};
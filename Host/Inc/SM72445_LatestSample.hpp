@@ -0,0 +1,71 @@
+/**
+ ******************************************************************************
+ * @file			: SM72445_LatestSample.hpp
+ * @brief			: Wait-free latest REG1 sample cell for multithreaded readers.
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#pragma once
+
+#include "SM72445.hpp"
+#include "SM72445_SeqLock.hpp"
+
+/**
+ * @brief Holds the newest electrical measurements of one device for any number of
+ * reader threads.
+ *
+ * @details
+ * The polling thread updates the cell after each REG1 read; readers copy the latest
+ * sample from a SeqLock without blocking the writer or touching the bus. Readers may
+ * convert the raw register with SM72445_X::convertElectricalMeasurements().
+ *
+ * @note Only one thread may update a given cell.
+ */
+class LatestSample {
+public:
+	/**
+	 * @brief A timestamped REG1 image.
+	 */
+	struct Sample {
+		SM72445::Register reg1;
+		uint64_t		  timestamp; // Steady clock nanoseconds at the time of update.
+		uint64_t		  count;	 // Number of samples stored, starting at 1.
+	};
+
+private:
+	SeqLock<Sample> cell;
+	uint64_t		count; // Writer-private.
+
+public:
+	LatestSample();
+
+	LatestSample(const LatestSample &) = delete;
+
+	/**
+	 * @brief Read REG1 from the SM72445 and publish it if successful.
+	 *
+	 * @param sm72445 The device this cell represents.
+	 * @return The register read, if successful.
+	 */
+	optional<SM72445::Reg1> update(const SM72445 &sm72445);
+
+	/**
+	 * @brief Publish a REG1 image obtained elsewhere. Wait-free.
+	 */
+	void store(const SM72445::Reg1 &reg1);
+
+	/**
+	 * @brief Get the newest sample. Never blocks the writer.
+	 *
+	 * @return The sample, if any has been stored.
+	 */
+	optional<Sample> load(void) const;
+
+	/**
+	 * @brief Get the newest electrical measurements register.
+	 *
+	 * @return The register, if any has been stored.
+	 */
+	optional<SM72445::Reg1> getElectricalMeasurementsRegister(void) const;
+};
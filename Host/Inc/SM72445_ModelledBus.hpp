@@ -0,0 +1,124 @@
+/**
+ ******************************************************************************
+ * @file			: SM72445_ModelledBus.hpp
+ * @brief			: I2C decorator accounting virtual bus time per transaction.
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#pragma once
+
+#include "SM72445.hpp"
+
+/**
+ * @brief I2C decorator modelling the time each transaction would occupy a real bus.
+ *
+ * @details
+ * Transactions are passed through unchanged and complete immediately, but a virtual
+ * clock is advanced by the time the transaction would take on the wire. This allows
+ * polling strategies to be compared by bus utilisation without sleeping.
+ *
+ * Register transactions are SMBus block transfers, with every byte taking nine clocks
+ * (eight data bits and an acknowledge), and each START, repeated START and STOP taking
+ * one clock:
+ *
+ *  Read:	S | Addr+W | Reg | Sr | Addr+R | Count | Data[7] | P
+ *  Write:	S | Addr+W | Reg | Count | Data[7] | P
+ *
+ * A failed transaction is modelled as the address not being acknowledged:
+ *
+ *  Failed:	S | Addr | P
+ *
+ * Every transaction is followed by the bus free time (tBUF) of the clock rate, plus any
+ * clock stretching by the target.
+ *
+ * @note Not thread-safe, as a bus serialises its transactions.
+ */
+class ModelledBusI2C : public SM72445::I2C {
+public:
+	enum class ClockRate : uint32_t {
+		STANDARD  = 100'000u,	// 100 kHz.
+		FAST	  = 400'000u,	// 400 kHz.
+		FAST_PLUS = 1'000'000u, // 1 MHz.
+	};
+
+	static constexpr uint32_t READ_CLOCKS	= 1u + 9u + 9u + 1u + 9u + 9u + 7u * 9u + 1u;
+	static constexpr uint32_t WRITE_CLOCKS	= 1u + 9u + 9u + 9u + 7u * 9u + 1u;
+	static constexpr uint32_t FAILED_CLOCKS = 1u + 9u + 1u;
+
+private:
+	SM72445::I2C   &i2c;
+	const ClockRate clockRate;
+	const uint32_t	clockStretch; // Nanoseconds per transaction.
+
+	uint64_t now;	   // Virtual time, in nanoseconds.
+	uint64_t busy;	   // Virtual time spent in transactions.
+	uint64_t transactions;
+
+public:
+	/**
+	 * @brief Construct a new Modelled Bus I2C.
+	 *
+	 * @param i2c The I2C interface (e.g. a SimulatedSM72445) to pass transactions to.
+	 * @param clockRate The SCL frequency of the modelled bus.
+	 * @param clockStretch Nanoseconds the target holds SCL low in each transaction.
+	 */
+	ModelledBusI2C(
+		SM72445::I2C &i2c,
+		ClockRate	  clockRate	   = ClockRate::FAST,
+		uint32_t	  clockStretch = 0u
+	);
+	virtual ~ModelledBusI2C() = default;
+
+	virtual optional<Register> read( //
+		DeviceAddress deviceAddress,
+		MemoryAddress memoryAddress
+	) override final;
+
+	virtual optional<Register> write(
+		DeviceAddress deviceAddress,
+		MemoryAddress memoryAddress,
+		Register	  data
+	) override final;
+
+	/**
+	 * @brief Get the virtual time a transaction of the given clock count occupies the
+	 * bus, including bus free time and clock stretching.
+	 */
+	uint64_t getTransactionTime(uint32_t clocks) const;
+
+	/**
+	 * @brief Advance the virtual clock with the bus idle, e.g. between polling cycles.
+	 */
+	void advance(uint64_t nanoseconds);
+
+	/**
+	 * @brief Get the virtual time in nanoseconds since construction or reset().
+	 */
+	uint64_t getTime(void) const;
+
+	/**
+	 * @brief Get the virtual time in nanoseconds spent in transactions.
+	 */
+	uint64_t getBusyTime(void) const;
+
+	/**
+	 * @brief Get the number of transactions made.
+	 */
+	uint64_t getTransactionCount(void) const;
+
+	/**
+	 * @brief Get the fraction of virtual time the bus was busy.
+	 *
+	 * @return The utilisation from 0 to 1, or 0 if no time has passed.
+	 */
+	float getUtilisation(void) const;
+
+	/**
+	 * @brief Zero the virtual clock and all counters.
+	 */
+	void reset(void);
+
+private:
+	void account(uint32_t clocks);
+};
@@ -0,0 +1,240 @@
+/**
+ ******************************************************************************
+ * @file			: SM72445_Registry.hpp
+ * @brief			: Fleet membership registry with epoch-based reclamation.
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#pragma once
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+#include "SM72445_X.hpp"
+
+/**
+ * @brief The devices of a fleet, which may be added, removed or moved between buses while
+ * poll threads keep iterating over them.
+ *
+ * @details
+ * Membership is published as immutable snapshots. A poll thread pins the current
+ * snapshot through its Reader for one cycle, lock-free and without allocation, and
+ * iterates its bus's devices from it. A change copies the membership into a new
+ * snapshot, publishes it atomically, and retires the previous one; pinned snapshots stay
+ * valid until unpinned, so a change never waits for, or interrupts, a poll thread.
+ *
+ * Retired snapshots are reclaimed by epoch: each change advances a global epoch, each
+ * pin records the epoch it started in, and a snapshot retired in an epoch is freed once
+ * no reader remains pinned from that epoch or earlier. Reclamation is performed by the
+ * changing thread, never by poll threads.
+ *
+ * Each bus's devices are contiguous within a snapshot, so a thread polling one bus does
+ * not see the members of others, and maintenance on one bus does not change the work of
+ * threads polling another.
+ *
+ * @note Changes are serialised by a mutex, which poll threads never take.
+ */
+class DeviceRegistry {
+public:
+	using DeviceId		= uint32_t;
+	using DeviceAddress = SM72445::DeviceAddress;
+	using Calibration	= SM72445_X::Calibration;
+
+	static constexpr size_t MAX_READERS = 64u;
+
+	/**
+	 * @brief A device and where it is attached.
+	 */
+	struct Member {
+		DeviceId  id;
+		uint8_t	  bus;
+		SM72445_X device; // Bound to the bus's I2C interface.
+	};
+
+	/**
+	 * @brief An immutable view of the fleet's membership.
+	 */
+	class Snapshot {
+	public:
+		/**
+		 * @brief A contiguous run of members.
+		 */
+		struct Range {
+			const Member *first;
+			const Member *last;
+
+			const Member *begin(void) const { return this->first; }
+			const Member *end(void) const { return this->last; }
+			size_t		  size(void) const { return size_t(this->last - this->first); }
+		};
+
+	private:
+		friend class DeviceRegistry;
+
+		std::vector<Member> members; // Ordered by bus, then by id.
+		std::vector<size_t> offsets; // Index of each bus's first member, then the size.
+		uint64_t			version;
+
+		Snapshot(void) = default;
+
+	public:
+		/**
+		 * @brief Get every member, ordered by bus and then by id.
+		 */
+		Range getMembers(void) const;
+
+		/**
+		 * @brief Get the members attached to a bus, ordered by id.
+		 */
+		Range getBus(uint8_t bus) const;
+
+		/**
+		 * @brief Find a member by id.
+		 *
+		 * @return The member, or nullptr if not present.
+		 */
+		const Member *find(DeviceId id) const;
+
+		/**
+		 * @brief Get the number of changes published before this snapshot.
+		 */
+		uint64_t getVersion(void) const;
+	};
+
+private:
+	struct alignas(64) ReaderSlot { // One cache line each, so pins do not contend.
+		std::atomic<bool>	  claimed{false};
+		std::atomic<uint64_t> epoch{0u}; // The epoch of the current pin, or 0 if none.
+	};
+
+	struct Retired {
+		const Snapshot *snapshot;
+		uint64_t		epoch;
+	};
+
+public:
+	/**
+	 * @brief Keeps a snapshot valid for as long as it exists.
+	 */
+	class Guard {
+		friend class DeviceRegistry;
+
+		std::atomic<uint64_t> *slot;
+		const Snapshot		  *snapshot;
+
+		Guard(std::atomic<uint64_t> &slot, const Snapshot &snapshot);
+
+	public:
+		Guard(Guard &&other) noexcept;
+		Guard(const Guard &) = delete;
+		~Guard();
+
+		const Snapshot &operator*(void) const { return *this->snapshot; }
+		const Snapshot *operator->(void) const { return this->snapshot; }
+	};
+
+	/**
+	 * @brief A poll thread's handle for pinning snapshots.
+	 *
+	 * @note A reader must be used by one thread at a time, holding at most one Guard.
+	 */
+	class Reader {
+		friend class DeviceRegistry;
+
+		DeviceRegistry *registry;
+		ReaderSlot	   *slot;
+
+		Reader(DeviceRegistry &registry, ReaderSlot &slot);
+
+	public:
+		Reader(Reader &&other) noexcept;
+		Reader(const Reader &) = delete;
+		~Reader();
+
+		/**
+		 * @brief Pin the current snapshot. Lock-free and allocation-free.
+		 */
+		Guard pin(void) const;
+	};
+
+private:
+	const std::vector<SM72445::I2C *> buses;
+
+	std::atomic<const Snapshot *> current;
+	std::atomic<uint64_t>		  epoch;
+	array<ReaderSlot, MAX_READERS> slots;
+
+	std::mutex			 mutex; // Serialises changes.
+	std::vector<Retired> retired;
+
+public:
+	/**
+	 * @brief Construct a new, empty Device Registry.
+	 *
+	 * @param buses The I2C interface of each bus, indexed by bus. They must outlive the
+	 * registry.
+	 */
+	explicit DeviceRegistry(std::vector<SM72445::I2C *> buses);
+
+	DeviceRegistry(const DeviceRegistry &) = delete;
+
+	/**
+	 * @brief Destroy the registry. Every Reader must have been destroyed.
+	 */
+	~DeviceRegistry();
+
+	/**
+	 * @brief Claim a reader for a poll thread.
+	 *
+	 * @return The reader, or nullopt if MAX_READERS are in use.
+	 */
+	optional<Reader> addReader(void);
+
+	/**
+	 * @brief Add a device.
+	 *
+	 * @return True if added, i.e. the id is new and the bus exists.
+	 */
+	bool add(
+		DeviceId		   id,
+		uint8_t			   bus,
+		DeviceAddress	   deviceAddress,
+		const Calibration &calibration
+	);
+
+	/**
+	 * @brief Remove a device.
+	 *
+	 * @return True if removed, i.e. the id was present.
+	 */
+	bool remove(DeviceId id);
+
+	/**
+	 * @brief Move a device to another bus or address, keeping its id and calibration.
+	 *
+	 * @return True if moved, i.e. the id was present and the bus exists.
+	 */
+	bool move(DeviceId id, uint8_t bus, DeviceAddress deviceAddress);
+
+	/**
+	 * @brief Free retired snapshots no longer pinned. Changes also do so.
+	 *
+	 * @return The number of retired snapshots still pinned.
+	 */
+	size_t reclaim(void);
+
+	/**
+	 * @brief Get the number of buses.
+	 */
+	size_t getBusCount(void) const;
+
+private:
+	struct Placement;
+
+	static std::vector<Placement> getPlacements(const Snapshot &snapshot);
+
+	void   publish(std::vector<Placement> placements);
+	size_t reclaimRetired(void);
+};
@@ -0,0 +1,186 @@
+/**
+ ******************************************************************************
+ * @file			: SM72445_Replay.hpp
+ * @brief			: Record-and-replay I2C transports for offline benchmarking.
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#pragma once
+
+#include <chrono>
+#include <istream>
+#include <ostream>
+#include <vector>
+
+#include "SM72445.hpp"
+
+/**
+ * @brief A recorded log of I2C transactions with one or more SM72445 devices.
+ *
+ * @details
+ * The log is serialised as plain text, one transaction per line:
+ * @code
+ * <timestamp_us> <R|W> <deviceAddress> <memoryAddress> <data|->
+ * @endcode
+ * Addresses and data are hexadecimal. A "-" in place of the data records a failed
+ * transaction (i.e. a nullopt return).
+ */
+struct I2CLog {
+	using DeviceAddress = SM72445::DeviceAddress;
+	using MemoryAddress = SM72445::MemoryAddress;
+	using Register		= SM72445::Register;
+
+	enum class Operation : uint8_t {
+		READ,
+		WRITE,
+	};
+
+	struct Entry {
+		uint64_t		   timestamp; // Microseconds since the start of the session.
+		Operation		   operation;
+		DeviceAddress	   deviceAddress;
+		MemoryAddress	   memoryAddress;
+		optional<Register> data;
+	};
+
+	std::vector<Entry> entries;
+
+	/**
+	 * @brief Serialise the log to a text stream.
+	 *
+	 * @param stream The stream to write to.
+	 */
+	void save(std::ostream &stream) const;
+
+	/**
+	 * @brief Deserialise a log from a text stream.
+	 *
+	 * @param stream The stream to read from.
+	 * @return The log, if every line was well formed.
+	 */
+	static optional<I2CLog> load(std::istream &stream);
+};
+
+/**
+ * @brief I2C decorator that captures every transaction passing through to a live bus.
+ *
+ * @note Not thread-safe. Each bus should be recorded by its own RecordingI2C.
+ */
+class RecordingI2C : public SM72445::I2C {
+	using Clock = std::chrono::steady_clock;
+
+	SM72445::I2C	 &i2c;
+	I2CLog			  log;
+	Clock::time_point start;
+
+public:
+	/**
+	 * @brief Construct a new Recording I2C decorator.
+	 *
+	 * @param i2c The live I2C interface to forward transactions to.
+	 */
+	RecordingI2C(SM72445::I2C &i2c);
+	virtual ~RecordingI2C() = default;
+
+	virtual optional<Register> read( //
+		DeviceAddress deviceAddress,
+		MemoryAddress memoryAddress
+	) override final;
+
+	virtual optional<Register> write(
+		DeviceAddress deviceAddress,
+		MemoryAddress memoryAddress,
+		Register	  data
+	) override final;
+
+	/**
+	 * @brief Get the transactions recorded so far.
+	 */
+	const I2CLog &getLog(void) const;
+
+	/**
+	 * @brief Discard all recorded transactions and restart the session clock.
+	 */
+	void clear(void);
+};
+
+/**
+ * @brief I2C implementation that serves transactions from a recorded I2CLog.
+ *
+ * @details
+ * Each DeviceAddress/MemoryAddress pair is replayed as an independent stream, so the
+ * order of reads between registers need not match the recording exactly. Reads of a
+ * register that was never recorded return nullopt. Writes are acknowledged with the
+ * data given unless the corresponding recorded write failed.
+ *
+ * @note Not thread-safe.
+ */
+class ReplayI2C : public SM72445::I2C {
+public:
+	enum class Pacing : uint8_t {
+		AS_FAST_AS_POSSIBLE, // Serve each transaction immediately.
+		REAL_TIME,			 // Block until the transaction's recorded timestamp.
+	};
+
+private:
+	using Clock = std::chrono::steady_clock;
+
+	struct Sample {
+		uint64_t		   timestamp;
+		optional<Register> data;
+	};
+
+	struct Stream {
+		std::vector<Sample> samples;
+		size_t				cursor = 0u;
+		uint64_t			lap	   = 0u;
+	};
+
+	// Indexed by [deviceAddress][memoryAddress - REG0]. Register numbers occupy 3 bits.
+	typedef array<array<Stream, 8>, 8> Streams;
+
+	Streams reads;
+	Streams writes;
+
+	const Pacing pacing;
+	const bool	 loop;
+	uint64_t	 duration; // Length of the recording, in microseconds.
+
+	optional<Clock::time_point> start;
+
+public:
+	/**
+	 * @brief Construct a new Replay I2C.
+	 *
+	 * @param log The recording to replay. It is copied and indexed on construction.
+	 * @param pacing Whether to serve transactions immediately or at recorded times.
+	 * @param loop If true, each stream restarts once exhausted. Otherwise exhausted
+	 * streams fail as if the device stopped responding.
+	 */
+	ReplayI2C(
+		const I2CLog &log,
+		Pacing		  pacing = Pacing::AS_FAST_AS_POSSIBLE,
+		bool		  loop	 = true
+	);
+	virtual ~ReplayI2C() = default;
+
+	virtual optional<Register> read( //
+		DeviceAddress deviceAddress,
+		MemoryAddress memoryAddress
+	) override final;
+
+	virtual optional<Register> write(
+		DeviceAddress deviceAddress,
+		MemoryAddress memoryAddress,
+		Register	  data
+	) override final;
+
+	/**
+	 * @brief Rewind every stream to the start of the recording.
+	 */
+	void rewind(void);
+
+private:
+	const Sample *next(Stream &stream);
+};
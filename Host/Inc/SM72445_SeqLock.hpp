@@ -0,0 +1,124 @@
+/**
+ ******************************************************************************
+ * @file			: SM72445_SeqLock.hpp
+ * @brief			: Single-writer sequence lock for trivially copyable values.
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+/**
+ * @brief A single-writer, multiple-reader sequence lock.
+ *
+ * @details
+ * The writer never blocks and never waits on readers. Readers retry only if a store
+ * overlapped their copy. The value is held in 64-bit atomic words so that the structure
+ * is free of data races and may be placed in memory shared between processes.
+ *
+ * @tparam T A trivially copyable value type.
+ * @note Only one thread may call store() on a given SeqLock.
+ */
+template <typename T>
+class SeqLock {
+	static_assert(std::is_trivially_copyable<T>::value, "T must be trivially copyable");
+	static_assert(std::atomic<uint64_t>::is_always_lock_free, "Requires lock-free atomics");
+	static_assert(std::atomic<uint32_t>::is_always_lock_free, "Requires lock-free atomics");
+
+	static constexpr size_t WORDS = (sizeof(T) + 7u) / sizeof(uint64_t);
+
+	std::atomic<uint32_t> sequence;
+	std::atomic<uint64_t> words[WORDS];
+
+public:
+	SeqLock() : sequence{0u}, words{} {}
+
+	SeqLock(const SeqLock &) = delete;
+
+	/**
+	 * @brief Publish a new value. Wait-free.
+	 */
+	void store(const T &value) {
+		uint64_t buffer[WORDS] = {};
+		std::memcpy(buffer, &value, sizeof(T));
+
+		const uint32_t start = this->sequence.load(std::memory_order_relaxed);
+		this->sequence.store(start + 1u, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+
+		for (size_t i = 0; i < WORDS; i++) {
+			this->words[i].store(buffer[i], std::memory_order_relaxed);
+		}
+
+		this->sequence.store(start + 2u, std::memory_order_release);
+	}
+
+	/**
+	 * @brief Attempt to read a consistent value without retrying.
+	 *
+	 * @param value Receives the value if the read was consistent.
+	 * @return true if the value is consistent, false if a store was in progress.
+	 */
+	bool tryLoad(T &value) const {
+		const uint32_t before = this->sequence.load(std::memory_order_acquire);
+		if (before & 0x1u) return false;
+
+		uint64_t buffer[WORDS];
+		for (size_t i = 0; i < WORDS; i++) {
+			buffer[i] = this->words[i].load(std::memory_order_relaxed);
+		}
+
+		std::atomic_thread_fence(std::memory_order_acquire);
+		const uint32_t after = this->sequence.load(std::memory_order_relaxed);
+		if (before != after) return false;
+
+		std::memcpy(&value, buffer, sizeof(T));
+		return true;
+	}
+
+	/**
+	 * @brief Attempt to read a consistent value, giving up if the writer stalls.
+	 *
+	 * @param value Receives the value if a read was consistent.
+	 * @param attempts The number of reads to try while no store progresses. Reads
+	 * overlapping a writer that is still storing do not count.
+	 * @return true if the value is consistent, false if the writer stalled mid-store.
+	 * @note Use where the writer may never finish its store, e.g. across processes.
+	 */
+	bool tryLoad(T &value, size_t attempts) const {
+		uint32_t stalled = this->sequence.load(std::memory_order_relaxed);
+
+		for (size_t i = 0; i < attempts;) {
+			if (tryLoad(value)) return true;
+
+			const uint32_t sequence = this->sequence.load(std::memory_order_relaxed);
+			if (sequence == stalled) i++;
+			else {
+				stalled = sequence;
+				i		= 0u;
+			}
+		}
+		return false;
+	}
+
+	/**
+	 * @brief Read a consistent value, retrying while a store overlaps.
+	 */
+	T load(void) const {
+		T value;
+		while (!tryLoad(value)) {}
+		return value;
+	}
+
+	/**
+	 * @brief Get the number of stores made so far.
+	 */
+	uint32_t getVersion(void) const {
+		return this->sequence.load(std::memory_order_acquire) / 2u;
+	}
+};
@@ -0,0 +1,167 @@
+/**
+ ******************************************************************************
+ * @file			: SM72445_Simulator.hpp
+ * @brief			: Behavioural SM72445 device simulator with a PV panel model.
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#pragma once
+
+#include "SM72445.hpp"
+
+/**
+ * @brief Simulates a bus of SM72445 devices behind the SM72445::I2C interface.
+ *
+ * @details
+ * Each device models a PV panel I-V curve feeding a converter with a fixed output
+ * (battery) voltage. A perturb-and-observe MPPT advances one iteration per call to
+ * step(), honouring:
+ * - REG3 iOutMax and vOutMax limits (curtailment by moving off the maximum power
+ *   point towards open circuit),
+ * - REG3 a2Override panel mode (a switch/buck stage cannot regulate below vOut),
+ * - REG3 passThroughSelect/passThroughManual and bbReset,
+ * - REG5 current thresholds (pass-through below the low thresholds, MPPT above the
+ *   high thresholds).
+ *
+ * Register contents use the same encodings as SM72445_Reg.cpp, and measurements are
+ * scaled with the same gain convention as SM72445_X. The simulation is deterministic
+ * and does not allocate; reads are served from register images refreshed by step().
+ */
+class SimulatedSM72445 : public SM72445::I2C {
+public:
+	/**
+	 * @brief Measurement gains, with the same meaning as the SM72445_X constructor.
+	 */
+	struct Gains {
+		float vInGain;
+		float vOutGain;
+		float iInGain;
+		float iOutGain;
+		float vDDA = 5.0f;
+	};
+
+	/**
+	 * @brief Single-diode PV panel approximation.
+	 * I(V) = irradiance * iSc * (1 - exp((V - vOc) / vT))
+	 */
+	struct Panel {
+		float iSc; // Short circuit current at full irradiance, in Amps.
+		float vOc; // Open circuit voltage, in Volts.
+		float vT;  // Ideality-scaled thermal voltage of the series string, in Volts.
+	};
+
+	/**
+	 * @brief True (unquantised) state of a simulated device.
+	 */
+	struct OperatingPoint {
+		float vIn;
+		float iIn;
+		float vOut;
+		float iOut;
+		bool  passThrough;
+	};
+
+private:
+	struct Device {
+		bool  present = false;
+		Panel panel;
+		float irradiance;
+		float efficiency;
+
+		OperatingPoint point;
+
+		float mpptStep;
+		float lastPower;
+		bool  increasing;
+		bool  thresholdPassThrough;
+
+		Register reg0;
+		Register reg1;
+		Register reg3;
+		Register reg4;
+		Register reg5;
+	};
+
+	const Gains gains;
+
+	array<Device, 8> devices; // Indexed by DeviceAddress.
+
+public:
+	/**
+	 * @brief Construct a new Simulated SM72445 bus with no devices attached.
+	 *
+	 * @param gains The measurement gains applied to all devices on this bus.
+	 */
+	SimulatedSM72445(const Gains &gains);
+	virtual ~SimulatedSM72445() = default;
+
+	/**
+	 * @brief Attach a simulated device to the bus, in its reset state.
+	 *
+	 * @param deviceAddress The address of the device.
+	 * @param panel The PV panel connected to the device input.
+	 * @param vOut The output (battery) voltage, in Volts.
+	 * @param efficiency The converter efficiency, between 0 and 1.
+	 */
+	void addDevice(
+		DeviceAddress deviceAddress,
+		const Panel	 &panel,
+		float		  vOut,
+		float		  efficiency = 0.96f
+	);
+
+	/**
+	 * @brief Detach a simulated device. Subsequent transactions with it will fail.
+	 */
+	void removeDevice(DeviceAddress deviceAddress);
+
+	/**
+	 * @brief Set the irradiance on a device's panel, as a fraction of full sun.
+	 */
+	void setIrradiance(DeviceAddress deviceAddress, float irradiance);
+
+	/**
+	 * @brief Set the output (battery) voltage of a device, in Volts.
+	 */
+	void setOutputVoltage(DeviceAddress deviceAddress, float vOut);
+
+	/**
+	 * @brief Set the strapped analogue configuration channel results of a device.
+	 */
+	void setAnalogueChannels(DeviceAddress deviceAddress, const SM72445::Reg0 &reg0);
+
+	/**
+	 * @brief Advance every attached device by a number of MPPT iterations.
+	 */
+	void step(uint32_t iterations = 1u);
+
+	/**
+	 * @brief Get the true operating point of a device.
+	 *
+	 * @return The operating point, if the device is attached.
+	 */
+	optional<OperatingPoint> getOperatingPoint(DeviceAddress deviceAddress) const;
+
+	virtual optional<Register> read( //
+		DeviceAddress deviceAddress,
+		MemoryAddress memoryAddress
+	) override final;
+
+	virtual optional<Register> write(
+		DeviceAddress deviceAddress,
+		MemoryAddress memoryAddress,
+		Register	  data
+	) override final;
+
+private:
+	Device		 *getDevice(DeviceAddress deviceAddress);
+	const Device *getDevice(DeviceAddress deviceAddress) const;
+
+	void	 step(Device &device) const;
+	bool	 operateMppt(Device &device, const SM72445::Reg3 &reg3, bool buckOnly) const;
+	void	 operatePassThrough(Device &device) const;
+	float	 getPanelCurrent(const Device &device, float vIn) const;
+	uint16_t toCounts(float value, float gain) const;
+	float	 fromCounts(uint16_t counts, float gain) const;
+};
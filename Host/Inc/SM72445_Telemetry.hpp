@@ -0,0 +1,184 @@
+/**
+ ******************************************************************************
+ * @file			: SM72445_Telemetry.hpp
+ * @brief			: Shared-memory telemetry segment for multi-process consumers.
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#pragma once
+
+#include <string>
+
+#include "SM72445.hpp"
+#include "SM72445_SeqLock.hpp"
+
+/**
+ * @brief A POSIX shared-memory segment holding the latest raw REG1 and REG3 images of
+ * every device on one or more buses.
+ *
+ * @details
+ * One process owns the buses and publishes into the segment through TelemetryPublisher.
+ * Every other process maps the same segment and reads through TelemetryReader, which
+ * serves register reads directly from memory. Each device slot is protected by its own
+ * SeqLock, so readers never block the publisher and never make system calls.
+ */
+class TelemetrySegment {
+public:
+	using Register		= SM72445::Register;
+	using DeviceAddress = SM72445::DeviceAddress;
+
+	enum Flags : uint64_t {
+		REG1_VALID = 0x1u,
+		REG3_VALID = 0x2u,
+	};
+
+	/**
+	 * @brief The published state of a single device.
+	 */
+	struct Record {
+		Register reg1;
+		Register reg3;
+		uint64_t timestamp; // Steady clock nanoseconds of the last update.
+		uint64_t flags;		// Bitwise OR of Flags.
+	};
+
+	static constexpr uint8_t DEVICES_PER_BUS = 8u; // Indexed by DeviceAddress.
+
+private:
+	struct Header;
+	struct Slot;
+
+	std::string name;
+	bool		owner;
+	Header	   *header;
+	size_t		size;
+
+	TelemetrySegment(const std::string &name, bool owner, Header *header, size_t size);
+
+public:
+	/**
+	 * @brief Create a named segment. The segment is unlinked when the returned object is
+	 * destroyed.
+	 *
+	 * @param name The POSIX shared-memory object name, e.g. "/sm72445".
+	 * @param busCount The number of buses the segment holds devices for.
+	 * @return The mapped segment, if successful.
+	 * @note Fails if the name is held by another segment, unless the process which
+	 * created that segment has exited, in which case the stale segment is replaced. A
+	 * segment whose creator is unknown, having died before recording itself, is
+	 * replaced once it is older than a few seconds.
+	 */
+	static optional<TelemetrySegment> create(const std::string &name, uint8_t busCount);
+
+	/**
+	 * @brief Map an existing named segment created by another process, read-only.
+	 *
+	 * @param name The POSIX shared-memory object name.
+	 * @return The mapped segment, if it exists and is compatible.
+	 */
+	static optional<TelemetrySegment> open(const std::string &name);
+
+	TelemetrySegment(TelemetrySegment &&other) noexcept;
+	TelemetrySegment(const TelemetrySegment &) = delete;
+	~TelemetrySegment();
+
+	/**
+	 * @brief Get the number of buses held by the segment.
+	 */
+	uint8_t getBusCount(void) const;
+
+	/**
+	 * @brief Publish the state of a device. Wait-free.
+	 *
+	 * @note Only one thread (in one process) may publish to a given device slot, and only
+	 * through the segment returned by create(). Publishing to an opened segment has no
+	 * effect.
+	 */
+	void publish(uint8_t bus, DeviceAddress deviceAddress, const Record &record);
+
+	/**
+	 * @brief Read a consistent snapshot of the state of a device, without system calls.
+	 *
+	 * @return The record, if the slot exists. Check Record::flags for validity. nullopt
+	 * if the slot stays mid-store, as when its publisher died during a store.
+	 */
+	optional<Record> snapshot(uint8_t bus, DeviceAddress deviceAddress) const;
+
+private:
+	Slot		 *getSlot(uint8_t bus, DeviceAddress deviceAddress) const;
+	static size_t getSize(uint8_t busCount);
+	static bool	  isStale(const std::string &name);
+};
+
+/**
+ * @brief I2C decorator for the bus-owning process, publishing every successful REG1 and
+ * REG3 transaction on its bus into a TelemetrySegment.
+ */
+class TelemetryPublisher : public SM72445::I2C {
+	SM72445::I2C	 &i2c;
+	TelemetrySegment &segment;
+	const uint8_t	  bus;
+
+	// Local shadow of this bus' records, so that publishing never reads shared memory.
+	array<TelemetrySegment::Record, TelemetrySegment::DEVICES_PER_BUS> records;
+
+public:
+	/**
+	 * @brief Construct a new Telemetry Publisher.
+	 *
+	 * @param i2c The live I2C interface of the bus.
+	 * @param segment The segment to publish into.
+	 * @param bus The index of this bus within the segment.
+	 */
+	TelemetryPublisher(SM72445::I2C &i2c, TelemetrySegment &segment, uint8_t bus);
+	virtual ~TelemetryPublisher() = default;
+
+	virtual optional<Register> read( //
+		DeviceAddress deviceAddress,
+		MemoryAddress memoryAddress
+	) override final;
+
+	virtual optional<Register> write(
+		DeviceAddress deviceAddress,
+		MemoryAddress memoryAddress,
+		Register	  data
+	) override final;
+
+private:
+	void publish(DeviceAddress deviceAddress, MemoryAddress memoryAddress, Register data);
+};
+
+/**
+ * @brief Read-only I2C interface serving REG1 and REG3 from a TelemetrySegment.
+ *
+ * @details
+ * Aggregate an SM72445 or SM72445_X with this interface to convert published telemetry
+ * with the usual calibration, e.g. SM72445_X::getElectricalMeasurements(), at memory
+ * speed. Registers that have not been published, and all writes, return nullopt.
+ */
+class TelemetryReader : public SM72445::I2C {
+	const TelemetrySegment &segment;
+	const uint8_t			bus;
+
+public:
+	/**
+	 * @brief Construct a new Telemetry Reader.
+	 *
+	 * @param segment The segment to read from.
+	 * @param bus The index of the bus within the segment.
+	 */
+	TelemetryReader(const TelemetrySegment &segment, uint8_t bus);
+	virtual ~TelemetryReader() = default;
+
+	virtual optional<Register> read( //
+		DeviceAddress deviceAddress,
+		MemoryAddress memoryAddress
+	) override final;
+
+	virtual optional<Register> write(
+		DeviceAddress deviceAddress,
+		MemoryAddress memoryAddress,
+		Register	  data
+	) override final;
+};
@@ -0,0 +1,139 @@
+/**
+ ******************************************************************************
+ * @file			: SM72445_TraceRecorder.hpp
+ * @brief			: Per-thread trace event recorder with Chrome trace export.
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <thread>
+#include <vector>
+
+#include "SM72445_Trace.hpp"
+
+/**
+ * @brief Records trace events into per-thread buffers and exports them in the Chrome
+ * trace event format, viewable in chrome://tracing or Perfetto.
+ *
+ * @details
+ * Each thread appends to its own fixed-capacity buffer without locks or allocation;
+ * a mutex is taken only the first time a thread records into a recorder, or when it
+ * returns to a recorder after recording into several others. Buffers are
+ * not rings: once a thread's buffer is full, further events on that thread are dropped
+ * and counted, so exported begin/end pairs are never torn.
+ *
+ * Once installed, the recorder receives the driver's trace points if it was built with
+ * SM72445_TRACE. Applications may also record their own events, e.g. around a poll cycle.
+ */
+class TraceRecorder {
+public:
+	enum class Phase : uint8_t {
+		BEGIN,
+		END,
+	};
+
+	struct Event {
+		const char *name;	   // Must have static storage duration.
+		uint64_t	timestamp; // Raw counter ticks, converted to nanoseconds on export.
+		Phase		phase;
+	};
+
+private:
+	struct Buffer {
+		const uint32_t			 threadId;
+		const std::thread::id	 owner;
+		std::unique_ptr<Event[]> events;
+		std::atomic<size_t>		 size;
+		std::atomic<uint64_t>	 dropped;
+	};
+
+	static std::atomic<TraceRecorder *> active;
+
+	const uint64_t id; // Distinguishes recorders in per-thread caches.
+	const size_t   capacity;
+	const uint64_t originTicks;
+	const uint64_t originNanoseconds;
+
+	mutable std::mutex					 mutex;
+	std::vector<std::unique_ptr<Buffer>> buffers;
+
+public:
+	/**
+	 * @brief Construct a new Trace Recorder.
+	 *
+	 * @param capacity The number of events each thread may record.
+	 */
+	explicit TraceRecorder(size_t capacity = 1u << 16u);
+	~TraceRecorder();
+
+	TraceRecorder(const TraceRecorder &) = delete;
+
+	/**
+	 * @brief Check whether the driver was built with its trace points.
+	 */
+	static constexpr bool isCompiledIn(void) {
+#ifdef SM72445_TRACE
+		return true;
+#else
+		return false;
+#endif
+	}
+
+	/**
+	 * @brief Route the driver's trace points to this recorder.
+	 *
+	 * @note Only one recorder may be installed at a time. Uninstall before destruction.
+	 */
+	void install(void);
+
+	/**
+	 * @brief Stop routing the driver's trace points to this recorder, if installed.
+	 *
+	 * @details Returns only once no driver trace point is still recording into this
+	 * recorder, so the recorder may then be destroyed.
+	 */
+	void uninstall(void);
+
+	/**
+	 * @brief Record an event on the calling thread's buffer. Lock-free and allocation-free
+	 * after the first event of each thread.
+	 *
+	 * @note Timestamps are read from the CPU's invariant cycle counter where available,
+	 * which is assumed to be synchronised across cores.
+	 */
+	void record(const char *name, Phase phase);
+
+	/**
+	 * @brief Get the number of events recorded across all threads.
+	 */
+	size_t getEventCount(void) const;
+
+	/**
+	 * @brief Get the number of events dropped because a thread's buffer was full.
+	 */
+	uint64_t getDroppedCount(void) const;
+
+	/**
+	 * @brief Write all recorded events as Chrome trace event JSON.
+	 *
+	 * @details May be called while other threads record; events recorded concurrently
+	 * may or may not be included.
+	 */
+	void exportChromeTrace(std::ostream &stream) const;
+
+private:
+	Buffer &getBuffer(void);
+
+	static uint64_t getTicks(void);
+	static uint64_t getNanoseconds(void);
+
+#ifdef SM72445_TRACE
+	static void hook(const char *name, SM72445_Trace::Phase phase);
+#endif
+};
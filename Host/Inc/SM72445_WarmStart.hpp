@@ -0,0 +1,202 @@
+/**
+ ******************************************************************************
+ * @file			: SM72445_WarmStart.hpp
+ * @brief			: Persistent warm-start cache of device register images.
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#pragma once
+
+#include <string>
+
+#include "SM72445_Discovery.hpp"
+
+/**
+ * @brief A memory-mapped file holding the last known REG0, REG3, REG4 and REG5 images
+ * and the calibration of every device, keyed by bus index and DeviceAddress.
+ *
+ * @details
+ * After a restart, devices are constructed from their cached calibration and start
+ * polling REG1 immediately, without re-reading their slowly changing registers. A
+ * WarmStartValidator then confirms the cached images in the background, one register
+ * read at a time.
+ *
+ * The file has a fixed layout of one slot per bus and address, so that entries are
+ * updated in place. Each slot carries its own checksum: a slot torn by a crash
+ * mid-update, or otherwise corrupted, reads as a miss rather than as stale data. A file
+ * with an incompatible header or size is discarded and recreated empty.
+ *
+ * @note The file is in native byte order, and is not meant to move between machines.
+ * @note Not thread-safe. Use one cache object per file, from one thread.
+ */
+class WarmStartCache {
+public:
+	using Register		= SM72445::Register;
+	using DeviceAddress = SM72445::DeviceAddress;
+	using Calibration	= SM72445_X::Calibration;
+
+	/**
+	 * @brief The cached state of a single device.
+	 */
+	struct Entry {
+		Register	reg0;
+		Register	reg3;
+		Register	reg4;
+		Register	reg5;
+		Calibration calibration;
+
+		/**
+		 * @brief Construct the device from its cached calibration. No bus operations.
+		 */
+		SM72445_X makeDevice(SM72445::I2C &i2c, DeviceAddress deviceAddress) const;
+	};
+
+	static constexpr uint8_t DEVICES_PER_BUS = 8u; // Indexed by DeviceAddress.
+
+private:
+	struct Header;
+	struct Slot;
+
+	Header *header;
+	size_t	size;
+
+	WarmStartCache(Header *header, size_t size);
+
+public:
+	/**
+	 * @brief Map a cache file, creating it if it does not exist or is incompatible.
+	 *
+	 * @param path The path of the cache file.
+	 * @param busCount The number of buses the cache holds devices for.
+	 * @return The mapped cache, if the file could be opened and mapped.
+	 */
+	static optional<WarmStartCache> open(const std::string &path, uint8_t busCount);
+
+	WarmStartCache(WarmStartCache &&other) noexcept;
+	WarmStartCache(const WarmStartCache &) = delete;
+	~WarmStartCache();
+
+	/**
+	 * @brief Get the number of buses held by the cache.
+	 */
+	uint8_t getBusCount(void) const;
+
+	/**
+	 * @brief Look up the cached state of a device.
+	 *
+	 * @return The entry, if one was stored and its checksum is intact.
+	 */
+	optional<Entry> lookup(uint8_t bus, DeviceAddress deviceAddress) const;
+
+	/**
+	 * @brief Store the state of a device, replacing any previous entry.
+	 */
+	void store(uint8_t bus, DeviceAddress deviceAddress, const Entry &entry);
+
+	/**
+	 * @brief Store a discovered device with its calibration.
+	 *
+	 * @return True if stored, i.e. all of the device's register images were read.
+	 */
+	bool store(const DeviceDiscovery::Device &device, const Calibration &calibration);
+
+	/**
+	 * @brief Remove the entry of a device.
+	 */
+	void invalidate(uint8_t bus, DeviceAddress deviceAddress);
+
+	/**
+	 * @brief Flush the mapping to the file.
+	 *
+	 * @return True if successful.
+	 */
+	bool sync(void);
+
+private:
+	Slot		 *getSlot(uint8_t bus, DeviceAddress deviceAddress) const;
+	static size_t getSize(uint8_t busCount);
+};
+
+/**
+ * @brief Lazily confirms the cached register images of one bus against the devices.
+ *
+ * @details
+ * Each call to validateNext() reads a single cached register of a single device, so the
+ * caller can interleave validation with REG1 polling at whatever rate its bus budget
+ * allows. Images that differ from the device are updated in the cache.
+ *
+ * A failed read is retried on the following calls. A device whose register still cannot
+ * be read after MAX_ATTEMPTS reads is taken to have left the bus, and its entry is
+ * evicted from the cache, so that it is discovered afresh on the next start.
+ */
+class WarmStartValidator {
+public:
+	using Register		= SM72445::Register;
+	using DeviceAddress = SM72445::DeviceAddress;
+	using MemoryAddress = SM72445::MemoryAddress;
+
+	enum class Status : uint8_t {
+		COMPLETE, // Every cached register of the bus is validated. No bus operation.
+		MATCHED,  // The register matched its cached image.
+		CHANGED,  // The register differed, and the cache was updated.
+		FAILED,	  // The read failed. The cached image is kept, and the read retried.
+		EVICTED,  // The read failed for the last time. The device's entry was removed.
+	};
+
+	static constexpr uint8_t MAX_ATTEMPTS = 3u; // Reads of a register before eviction.
+
+	static constexpr array<MemoryAddress, 4> REGISTERS = {
+		MemoryAddress::REG0,
+		MemoryAddress::REG3,
+		MemoryAddress::REG4,
+		MemoryAddress::REG5,
+	};
+
+private:
+	WarmStartCache &cache;
+	SM72445::I2C   &i2c;
+	const uint8_t	bus;
+
+	size_t	cursor;	  // Index into the bus's addresses and REGISTERS, in that order.
+	uint8_t attempts; // Failed reads of the register at the cursor.
+
+	uint32_t changed;
+	uint32_t failed;
+	uint32_t evicted;
+
+public:
+	/**
+	 * @brief Construct a new Warm Start Validator.
+	 *
+	 * @param cache The cache to validate and update.
+	 * @param i2c The live I2C interface of the bus.
+	 * @param bus The index of this bus within the cache.
+	 */
+	WarmStartValidator(WarmStartCache &cache, SM72445::I2C &i2c, uint8_t bus);
+
+	/**
+	 * @brief Validate the next cached register, with at most one register read.
+	 */
+	Status validateNext(void);
+
+	/**
+	 * @brief Check whether every cached register of the bus has been validated.
+	 */
+	bool isComplete(void) const;
+
+	/**
+	 * @brief Get the number of registers found changed so far.
+	 */
+	uint32_t getChangedCount(void) const;
+
+	/**
+	 * @brief Get the number of reads that failed so far.
+	 */
+	uint32_t getFailedCount(void) const;
+
+	/**
+	 * @brief Get the number of entries evicted so far.
+	 */
+	uint32_t getEvictedCount(void) const;
+};
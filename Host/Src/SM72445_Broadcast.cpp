@@ -0,0 +1,59 @@
+/**
+ ******************************************************************************
+ * @file			: SM72445_Broadcast.cpp
+ * @brief			: Source for SM72445_Broadcast.hpp
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "SM72445_Broadcast.hpp"
+
+using Register		 = ConfigBroadcast::Register;
+using ConfigRegister = ConfigBroadcast::ConfigRegister;
+using Bus			 = ConfigBroadcast::Bus;
+using Image			 = ConfigBroadcast::Image;
+using Report		 = ConfigBroadcast::Report;
+
+ConfigBroadcast::ConfigBroadcast(std::vector<Bus> buses)
+	: buses{std::move(buses)}, workers{this->buses.size()} {}
+
+/**
+ * @brief Write one bus's devices back-to-back, computing all images beforehand.
+ */
+static void writeBus(
+	const Bus						&bus,
+	const Image						&image,
+	std::vector<optional<Register>> &written
+) {
+	std::vector<ConfigRegister> images;
+	images.reserve(bus.size());
+	for (const SM72445_X *device : bus) images.push_back(image(*device));
+
+	// Sized by broadcast(), so writes not reached before an exception remain nullopt.
+	for (size_t i = 0; i < bus.size(); i++) written[i] = bus[i]->setConfig(images[i]);
+}
+
+Report ConfigBroadcast::broadcast(ConfigRegister configRegister) const {
+	return broadcast([configRegister](const SM72445_X &) { return configRegister; });
+}
+
+Report ConfigBroadcast::broadcast(const Image &image) const {
+	Report report{{}, {}, 0u, 0u};
+	report.written.reserve(this->buses.size());
+	for (const auto &bus : this->buses) report.written.emplace_back(bus.size());
+
+	report.errors = this->workers.run([&](size_t bus) {
+		writeBus(this->buses[bus], image, report.written[bus]);
+	});
+
+	for (const auto &bus : report.written) {
+		for (const auto &result : bus) (result ? report.succeeded : report.failed)++;
+	}
+	return report;
+}
+
+size_t ConfigBroadcast::getDeviceCount(void) const {
+	size_t count = 0u;
+	for (const auto &bus : this->buses) count += bus.size();
+	return count;
+}
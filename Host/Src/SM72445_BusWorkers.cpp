@@ -0,0 +1,110 @@
+/**
+ ******************************************************************************
+ * @file			: SM72445_BusWorkers.cpp
+ * @brief			: Source for SM72445_BusWorkers.hpp
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "SM72445_BusWorkers.hpp"
+
+BusWorkers::BusWorkers(size_t busCount)
+	: busCount{busCount},
+	  runMutex{},
+	  mutex{},
+	  wake{},
+	  done{},
+	  task{nullptr},
+	  generation{0u},
+	  pending{0u},
+	  stopping{false},
+	  errors{nullptr},
+	  workers{} {
+	try {
+		this->workers.reserve(busCount > 0u ? busCount - 1u : 0u);
+		for (size_t bus = 1; bus < busCount; bus++) {
+			this->workers.emplace_back(&BusWorkers::serve, this, bus);
+		}
+	} catch (...) {
+		stop();
+		throw;
+	}
+}
+
+BusWorkers::~BusWorkers() { stop(); }
+
+void BusWorkers::stop(void) {
+	{
+		std::lock_guard<std::mutex> lock(this->mutex);
+		this->stopping = true;
+	}
+	this->wake.notify_all();
+
+	for (auto &worker : this->workers) worker.join();
+	this->workers.clear();
+}
+
+/**
+ * @brief Run a task, capturing any exception it throws.
+ */
+static std::exception_ptr capture(const BusWorkers::Task &task, size_t bus) {
+	try {
+		task(bus);
+	} catch (...) {
+		return std::current_exception();
+	}
+	return nullptr;
+}
+
+void BusWorkers::serve(size_t bus) {
+	uint64_t seen = 0u;
+
+	while (true) {
+		const Task *current;
+		{
+			std::unique_lock<std::mutex> lock(this->mutex);
+			this->wake.wait(lock, [&] {
+				return this->stopping || this->generation != seen;
+			});
+			if (this->stopping) return;
+
+			seen	= this->generation;
+			current = this->task;
+		}
+
+		// Each bus writes only its own element, which run() sized before waking us.
+		(*this->errors)[bus] = capture(*current, bus);
+
+		std::lock_guard<std::mutex> lock(this->mutex);
+		if (--this->pending == 0u) this->done.notify_one();
+	}
+}
+
+std::vector<std::exception_ptr> BusWorkers::run(const Task &task) {
+	std::lock_guard<std::mutex> runLock(this->runMutex);
+
+	std::vector<std::exception_ptr> errors(this->busCount);
+	if (this->busCount == 0u) return errors;
+
+	{
+		std::lock_guard<std::mutex> lock(this->mutex);
+		this->task	  = &task;
+		this->errors  = &errors;
+		this->pending = this->workers.size();
+		this->generation++;
+	}
+	this->wake.notify_all();
+
+	errors[0] = capture(task, 0u);
+
+	std::unique_lock<std::mutex> lock(this->mutex);
+	this->done.wait(lock, [&] { return this->pending == 0u; });
+
+	this->task	 = nullptr;
+	this->errors = nullptr;
+	return errors;
+}
+
+size_t BusWorkers::getBusCount(void) const {
+	return this->busCount;
+}
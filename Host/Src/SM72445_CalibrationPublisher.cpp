@@ -0,0 +1,124 @@
+/**
+ ******************************************************************************
+ * @file			: SM72445_CalibrationPublisher.cpp
+ * @brief			: Source for SM72445_CalibrationPublisher.hpp
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "SM72445_CalibrationPublisher.hpp"
+
+#include <algorithm>
+
+using Calibration = CalibrationPublisher::Calibration;
+using Guard		  = CalibrationPublisher::Guard;
+using Reader	  = CalibrationPublisher::Reader;
+
+using std::nullopt;
+
+/*
+ * The device's calibration pointer is published and loaded with release and acquire
+ * ordering only, so a full fence separates it from the epochs on both sides: a reader
+ * which loads a block after pinning is seen pinned by any reclamation after the block is
+ * replaced, or otherwise loads its replacement. Every epoch access is sequentially
+ * consistent, as in DeviceRegistry.
+ */
+
+Guard::Guard(std::atomic<uint64_t> &slot) : slot{&slot} {}
+
+Guard::Guard(Guard &&other) noexcept : slot{other.slot} { other.slot = nullptr; }
+
+Guard::~Guard() {
+	if (this->slot) this->slot->store(0u, std::memory_order_seq_cst);
+}
+
+Reader::Reader(CalibrationPublisher &publisher, ReaderSlot &slot)
+	: publisher{&publisher}, //
+	  slot{&slot} {}
+
+Reader::Reader(Reader &&other) noexcept
+	: publisher{other.publisher}, //
+	  slot{other.slot} {
+	other.slot = nullptr;
+}
+
+Reader::~Reader() {
+	if (this->slot) this->slot->claimed.store(false, std::memory_order_release);
+}
+
+Guard Reader::pin(void) const {
+	std::atomic<uint64_t> &epoch = this->slot->epoch;
+
+	epoch.store(this->publisher->epoch.load(std::memory_order_seq_cst));
+	std::atomic_thread_fence(std::memory_order_seq_cst); // Before any calibration load.
+
+	return Guard(epoch);
+}
+
+CalibrationPublisher::CalibrationPublisher() : epoch{1u} {}
+
+CalibrationPublisher::~CalibrationPublisher() {
+	for (const Retired &retired : this->retired) delete retired.block;
+	for (const Calibration *block : this->blocks) delete block;
+}
+
+optional<Reader> CalibrationPublisher::addReader(void) {
+	for (ReaderSlot &slot : this->slots) {
+		bool expected = false;
+		if (slot.claimed.compare_exchange_strong(expected, true)) {
+			return Reader(*this, slot);
+		}
+	}
+	return nullopt;
+}
+
+void CalibrationPublisher::publish(SM72445_X &device, const Calibration &calibration) {
+	std::lock_guard<std::mutex> lock{this->mutex};
+
+	const Calibration *block = new Calibration(calibration);
+	this->blocks.insert(block);
+
+	retire(device.setCalibration(block));
+}
+
+void CalibrationPublisher::restore(SM72445_X &device) {
+	std::lock_guard<std::mutex> lock{this->mutex};
+
+	retire(device.setCalibration(nullptr));
+}
+
+void CalibrationPublisher::retire(const Calibration *previous) {
+	std::atomic_thread_fence(std::memory_order_seq_cst); // After the calibration store.
+
+	// Blocks published by others, and the device's own, are not ours to free.
+	if (!previous || this->blocks.erase(previous) == 0u) return;
+
+	const uint64_t epoch = this->epoch.fetch_add(1u, std::memory_order_seq_cst);
+	this->retired.push_back(Retired{previous, epoch});
+	reclaimRetired();
+}
+
+size_t CalibrationPublisher::reclaim(void) {
+	std::lock_guard<std::mutex> lock{this->mutex};
+
+	return reclaimRetired();
+}
+
+size_t CalibrationPublisher::reclaimRetired(void) {
+	uint64_t oldest = UINT64_MAX; // The earliest epoch any reader remains pinned from.
+	for (const ReaderSlot &slot : this->slots) {
+		const uint64_t epoch = slot.epoch.load(std::memory_order_seq_cst);
+		if (epoch != 0u) oldest = std::min(oldest, epoch);
+	}
+
+	const auto reclaimable = [oldest](const Retired &retired) {
+		if (retired.epoch >= oldest) return false;
+		delete retired.block;
+		return true;
+	};
+	this->retired.erase(
+		std::remove_if(this->retired.begin(), this->retired.end(), reclaimable),
+		this->retired.end()
+	);
+	return this->retired.size();
+}
@@ -0,0 +1,191 @@
+/**
+ ******************************************************************************
+ * @file			: SM72445_ControlLoop.cpp
+ * @brief			: Source for SM72445_ControlLoop.hpp
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "SM72445_ControlLoop.hpp"
+
+#include <cerrno>
+#include <ctime>
+
+using Cycle		= ControlLoop::Cycle;
+using Stats		= ControlLoop::Stats;
+using Histogram = Stats::Histogram;
+
+/**
+ * @brief Get the value below which the given fraction of a histogram's samples fell.
+ */
+static uint64_t getQuantile(const Histogram &histogram, float quantile) {
+	// Counted from the histogram itself, which a snapshot taken while running may not
+	// have in step with Stats::cycles.
+	uint64_t samples = 0u;
+	for (uint64_t count : histogram) samples += count;
+
+	if (samples == 0u) return 0u;
+
+	// Rank of the quantile, rounded up so that e.g. the 0.5 quantile of one sample is it.
+	uint64_t rank = uint64_t(quantile * float(samples));
+	if (float(rank) < quantile * float(samples)) rank++;
+	if (rank == 0u) rank = 1u;
+
+	uint64_t seen = 0u;
+	for (size_t bucket = 0; bucket < histogram.size(); bucket++) {
+		seen += histogram[bucket];
+		if (seen >= rank) return InstrumentedI2C::getBucketUpperBound(bucket);
+	}
+	return InstrumentedI2C::getBucketUpperBound(histogram.size() - 1u);
+}
+
+uint64_t Stats::getJitterQuantile(float quantile) const {
+	return getQuantile(this->jitter, quantile);
+}
+
+uint64_t Stats::getExecutionQuantile(float quantile) const {
+	return getQuantile(this->execution, quantile);
+}
+
+ControlLoop::ControlLoop(
+	Devices	 devices,
+	uint64_t period,
+	Callback callback,
+	uint64_t shedAfter,
+	Clock	&clock
+)
+	: devices{std::move(devices)},
+	  period{period},
+	  shedAfter{shedAfter ? shedAfter : period / 2u},
+	  callback{std::move(callback)},
+	  clock{clock},
+	  stopping{false},
+	  index{0u},
+	  counters{} {}
+
+uint64_t ControlLoop::getTime(void) {
+	timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return uint64_t(now.tv_sec) * 1'000'000'000u + uint64_t(now.tv_nsec);
+}
+
+/**
+ * @brief Releases cycles with clock_nanosleep(TIMER_ABSTIME) on CLOCK_MONOTONIC.
+ */
+class MonotonicClock : public ControlLoop::Clock {
+public:
+	virtual uint64_t now(void) override final { return ControlLoop::getTime(); }
+
+	virtual void sleepUntil(uint64_t deadline) override final {
+		const timespec until{
+			static_cast<time_t>(deadline / 1'000'000'000u),
+			static_cast<long>(deadline % 1'000'000'000u),
+		};
+		while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &until, nullptr) == EINTR) {
+		}
+	}
+};
+
+ControlLoop::Clock &ControlLoop::getMonotonicClock(void) {
+	static MonotonicClock clock;
+	return clock;
+}
+
+uint64_t ControlLoop::run(uint64_t cycles) {
+	uint64_t deadline = this->clock.now();
+	uint64_t ran	  = 0u;
+
+	while (!this->stopping.load(std::memory_order_relaxed) && (!cycles || ran < cycles)) {
+		this->clock.sleepUntil(deadline);
+
+		const uint64_t woken = this->clock.now();
+		Cycle		   cycle{*this, this->index++, deadline, woken - deadline};
+
+		this->callback(cycle);
+
+		const uint64_t finished = this->clock.now();
+
+		// Skip, rather than run late, any deadlines that have already passed.
+		deadline		 += this->period;
+		uint64_t skipped  = 0u;
+		if (finished > deadline) {
+			skipped	  = (finished - deadline) / this->period + 1u;
+			deadline += skipped * this->period;
+		}
+
+		record(cycle, finished - woken, skipped);
+		ran++;
+	}
+
+	// Cleared on exit rather than entry, so that a stop() made before run() is kept.
+	this->stopping.store(false, std::memory_order_relaxed);
+	return ran;
+}
+
+static inline void increase(std::atomic<uint64_t> &counter, uint64_t amount) {
+	counter.fetch_add(amount, std::memory_order_relaxed);
+}
+
+static inline void raiseMaximum(std::atomic<uint64_t> &maximum, uint64_t value) {
+	// Only the loop's thread raises maxima; resetStats() may only lower them.
+	if (value > maximum.load(std::memory_order_relaxed)) {
+		maximum.store(value, std::memory_order_relaxed);
+	}
+}
+
+void ControlLoop::record(const Cycle &cycle, uint64_t execution, uint64_t skipped) {
+	Counters &counters = this->counters;
+
+	increase(counters.cycles, 1u);
+	if (skipped) increase(counters.misses, 1u);
+	increase(counters.skipped, skipped);
+	increase(counters.shed, cycle.shed);
+
+	raiseMaximum(counters.maxJitter, cycle.jitter);
+	raiseMaximum(counters.maxExecution, execution);
+
+	increase(counters.jitter[InstrumentedI2C::getBucket(cycle.jitter)], 1u);
+	increase(counters.execution[InstrumentedI2C::getBucket(execution)], 1u);
+}
+
+void ControlLoop::stop(void) { this->stopping.store(true, std::memory_order_relaxed); }
+
+Stats ControlLoop::getStats(void) const {
+	const Counters &counters = this->counters;
+	Stats			stats{};
+
+	stats.cycles	   = counters.cycles.load(std::memory_order_relaxed);
+	stats.misses	   = counters.misses.load(std::memory_order_relaxed);
+	stats.skipped	   = counters.skipped.load(std::memory_order_relaxed);
+	stats.shed		   = counters.shed.load(std::memory_order_relaxed);
+	stats.maxJitter	   = counters.maxJitter.load(std::memory_order_relaxed);
+	stats.maxExecution = counters.maxExecution.load(std::memory_order_relaxed);
+
+	for (size_t bucket = 0; bucket < InstrumentedI2C::BUCKETS; bucket++) {
+		stats.jitter[bucket]	= counters.jitter[bucket].load(std::memory_order_relaxed);
+		stats.execution[bucket] = counters.execution[bucket].load(std::memory_order_relaxed);
+	}
+	return stats;
+}
+
+void ControlLoop::resetStats(void) {
+	Counters &counters = this->counters;
+
+	for (Counter *counter : {
+			 &counters.cycles,
+			 &counters.misses,
+			 &counters.skipped,
+			 &counters.shed,
+			 &counters.maxJitter,
+			 &counters.maxExecution,
+		 }) {
+		counter->store(0u, std::memory_order_relaxed);
+	}
+
+	for (size_t bucket = 0; bucket < InstrumentedI2C::BUCKETS; bucket++) {
+		counters.jitter[bucket].store(0u, std::memory_order_relaxed);
+		counters.execution[bucket].store(0u, std::memory_order_relaxed);
+	}
+}
+
+uint64_t ControlLoop::getPeriod(void) const { return this->period; }
@@ -0,0 +1,59 @@
+/**
+ ******************************************************************************
+ * @file			: SM72445_Discovery.cpp
+ * @brief			: Source for SM72445_Discovery.hpp
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "SM72445_Discovery.hpp"
+
+#include "SM72445_BusWorkers.hpp"
+
+using Bus			= DeviceDiscovery::Bus;
+using Device		= DeviceDiscovery::Device;
+using Table			= DeviceDiscovery::Table;
+using MemoryAddress = SM72445::MemoryAddress;
+
+DeviceDiscovery::DeviceDiscovery(std::vector<Bus> buses) : buses{std::move(buses)} {}
+
+/**
+ * @brief Probe every address of one bus, then read the images of the devices found.
+ */
+static void discoverBus(const Bus &bus, size_t index, Table &table) {
+	SM72445::I2C &probe = bus.probe ? *bus.probe : *bus.i2c;
+
+	for (auto deviceAddress : DeviceDiscovery::ADDRESSES) {
+		const auto reg0 = probe.read(deviceAddress, MemoryAddress::REG0);
+		if (reg0) table.push_back({index, deviceAddress, *reg0, {}, {}, {}});
+	}
+
+	for (auto &device : table) {
+		device.reg3 = bus.i2c->read(device.deviceAddress, MemoryAddress::REG3);
+		device.reg4 = bus.i2c->read(device.deviceAddress, MemoryAddress::REG4);
+		device.reg5 = bus.i2c->read(device.deviceAddress, MemoryAddress::REG5);
+	}
+}
+
+Table DeviceDiscovery::discover(void) const {
+	std::vector<Table> found(this->buses.size());
+
+	// Discovery runs once at startup, so its workers need not outlive it.
+	BusWorkers workers{this->buses.size()};
+
+	const auto errors = workers.run([&](size_t bus) {
+		discoverBus(this->buses[bus], bus, found[bus]);
+	});
+
+	for (const auto &error : errors) {
+		if (error) std::rethrow_exception(error);
+	}
+
+	Table table;
+	for (const auto &bus : found) table.insert(table.end(), bus.begin(), bus.end());
+	return table;
+}
+
+bool DeviceDiscovery::Device::isComplete(void) const {
+	return this->reg3 && this->reg4 && this->reg5;
+}
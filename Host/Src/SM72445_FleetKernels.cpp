@@ -0,0 +1,371 @@
+/**
+ ******************************************************************************
+ * @file			: SM72445_FleetKernels.cpp
+ * @brief			: Source for SM72445_FleetKernels.hpp
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "SM72445_FleetKernels.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define SM72445_FLEET_AVX2
+#include <immintrin.h>
+#endif
+
+#if defined(__ARM_NEON) && defined(__aarch64__)
+#define SM72445_FLEET_NEON
+#include <arm_neon.h>
+#endif
+
+using DeviceId		 = FleetKernels::DeviceId;
+using InstructionSet = FleetKernels::InstructionSet;
+using Ranking		 = FleetKernels::Ranking;
+using Outputs		 = FleetKernels::Outputs;
+using Summary		 = FleetKernels::Summary;
+using Columns		 = FleetState::Columns;
+
+using ElectricalProperty = SM72445::ElectricalProperty;
+
+static constexpr uint8_t I_IN  = static_cast<uint8_t>(ElectricalProperty::CURRENT_IN);
+static constexpr uint8_t V_IN  = static_cast<uint8_t>(ElectricalProperty::VOLTAGE_IN);
+static constexpr uint8_t I_OUT = static_cast<uint8_t>(ElectricalProperty::CURRENT_OUT);
+static constexpr uint8_t V_OUT = static_cast<uint8_t>(ElectricalProperty::VOLTAGE_OUT);
+
+static constexpr float INF = std::numeric_limits<float>::infinity();
+
+/**
+ * @brief The running state of one evaluate() pass, shared by the vector body and the
+ * scalar remainder.
+ */
+struct FleetPass {
+	const Columns &columns;
+	const Outputs &outputs;
+
+	double powerIn	= 0.0;
+	double powerOut = 0.0;
+	size_t devices	= 0u;
+
+	size_t topCount	   = 0u;
+	size_t bottomCount = 0u;
+
+	// Efficiencies a device must beat to be ranked. Disabled rankings can't be beaten.
+	float topThreshold;
+	float bottomThreshold;
+
+	FleetPass(const Columns &columns, const Outputs &outputs)
+		: columns{columns},										   //
+		  outputs{outputs},										   //
+		  topThreshold{(outputs.top && outputs.k) ? -INF : INF},   //
+		  bottomThreshold{(outputs.bottom && outputs.k) ? INF : -INF} {}
+
+	/**
+	 * @brief Insert a device into the rankings if it beats the current k-th entry. Ties
+	 * keep the lower id, so results are independent of the block size.
+	 */
+	void offer(DeviceId id, float efficiency) {
+		const size_t k = this->outputs.k;
+
+		if (efficiency > this->topThreshold) {
+			Ranking *top = this->outputs.top;
+			size_t	 j	 = (this->topCount < k) ? this->topCount++ : k - 1u;
+			for (; j > 0u && top[j - 1u].efficiency < efficiency; j--)
+				top[j] = top[j - 1u];
+			top[j] = {id, efficiency};
+			if (this->topCount == k) this->topThreshold = top[k - 1u].efficiency;
+		}
+
+		if (efficiency < this->bottomThreshold) {
+			Ranking *bottom = this->outputs.bottom;
+			size_t	 j		= (this->bottomCount < k) ? this->bottomCount++ : k - 1u;
+			for (; j > 0u && bottom[j - 1u].efficiency > efficiency; j--)
+				bottom[j] = bottom[j - 1u];
+			bottom[j] = {id, efficiency};
+			if (this->bottomCount == k)
+				this->bottomThreshold = bottom[k - 1u].efficiency;
+		}
+	}
+
+	/**
+	 * @brief Evaluate devices [first, last) one at a time.
+	 */
+	void scalar(size_t first, size_t last) {
+		const auto &counts = this->columns.counts;
+		const auto &scales = this->columns.scales;
+
+		for (size_t i = first; i < last; i++) {
+			float pIn = 0.0f, pOut = 0.0f, efficiency = 0.0f;
+
+			if (this->columns.status[i] & FleetState::VALID) {
+				const float iIn	 = counts[I_IN][i] * scales[I_IN][i];
+				const float vIn	 = counts[V_IN][i] * scales[V_IN][i];
+				const float iOut = counts[I_OUT][i] * scales[I_OUT][i];
+				const float vOut = counts[V_OUT][i] * scales[V_OUT][i];
+
+				pIn	 = vIn * iIn;
+				pOut = vOut * iOut;
+
+				this->powerIn += pIn;
+				this->powerOut += pOut;
+				this->devices++;
+
+				if (pIn > 0.0f) {
+					efficiency = pOut / pIn;
+					offer(static_cast<DeviceId>(i), efficiency);
+				}
+			}
+
+			if (this->outputs.powerIn) this->outputs.powerIn[i] = pIn;
+			if (this->outputs.powerOut) this->outputs.powerOut[i] = pOut;
+			if (this->outputs.efficiency) this->outputs.efficiency[i] = efficiency;
+		}
+	}
+
+	Summary getSummary(void) const {
+		const size_t ranked = std::max(this->topCount, this->bottomCount);
+		return Summary{this->powerIn, this->powerOut, this->devices, ranked};
+	}
+};
+
+#ifdef SM72445_FLEET_AVX2
+
+__attribute__((target("avx2"))) static inline __m256 loadAvx2(
+	const Columns &columns,
+	uint8_t		   property,
+	size_t		   i
+) {
+	const auto *source = reinterpret_cast<const __m128i *>(columns.counts[property] + i);
+	const auto	counts = _mm256_cvtepu16_epi32(_mm_loadu_si128(source));
+	return _mm256_mul_ps(
+		_mm256_cvtepi32_ps(counts),
+		_mm256_loadu_ps(columns.scales[property] + i)
+	);
+}
+
+/**
+ * @brief Accumulate eight floats into four double-precision sums.
+ */
+__attribute__((target("avx2"))) static inline __m256d addAvx2(
+	__m256d sums,
+	__m256	values
+) {
+	sums = _mm256_add_pd(sums, _mm256_cvtps_pd(_mm256_castps256_ps128(values)));
+	return _mm256_add_pd(sums, _mm256_cvtps_pd(_mm256_extractf128_ps(values, 1)));
+}
+
+__attribute__((target("avx2"))) static void evaluateAvx2(FleetPass &pass) {
+	const Columns &columns = pass.columns;
+	const Outputs &outputs = pass.outputs;
+
+	const __m256  zero	   = _mm256_setzero_ps();
+	const __m256i validBit = _mm256_set1_epi32(FleetState::VALID);
+
+	__m256d powerIn = _mm256_setzero_pd(), powerOut = _mm256_setzero_pd();
+
+	size_t i = 0u;
+	for (; i + 8u <= columns.size; i += 8u) {
+		const auto	  *source = reinterpret_cast<const __m128i *>(columns.status + i);
+		const __m256i status  = _mm256_cvtepu8_epi32(_mm_loadl_epi64(source));
+		const __m256  valid	  = _mm256_castsi256_ps(
+			   _mm256_cmpeq_epi32(_mm256_and_si256(status, validBit), validBit)
+		   );
+
+		const __m256 pIn  = _mm256_and_ps(
+			 _mm256_mul_ps(loadAvx2(columns, V_IN, i), loadAvx2(columns, I_IN, i)),
+			 valid
+		 );
+		const __m256 pOut = _mm256_and_ps(
+			_mm256_mul_ps(loadAvx2(columns, V_OUT, i), loadAvx2(columns, I_OUT, i)),
+			valid
+		);
+		const __m256 rankable	= _mm256_cmp_ps(pIn, zero, _CMP_GT_OQ);
+		const __m256 efficiency = _mm256_and_ps(_mm256_div_ps(pOut, pIn), rankable);
+
+		powerIn	 = addAvx2(powerIn, pIn);
+		powerOut = addAvx2(powerOut, pOut);
+		pass.devices += __builtin_popcount(_mm256_movemask_ps(valid));
+
+		if (outputs.powerIn) _mm256_storeu_ps(outputs.powerIn + i, pIn);
+		if (outputs.powerOut) _mm256_storeu_ps(outputs.powerOut + i, pOut);
+		if (outputs.efficiency) _mm256_storeu_ps(outputs.efficiency + i, efficiency);
+
+		const __m256 top	= _mm256_set1_ps(pass.topThreshold);
+		const __m256 bottom = _mm256_set1_ps(pass.bottomThreshold);
+
+		const __m256 candidates = _mm256_and_ps(
+			_mm256_or_ps(
+				_mm256_cmp_ps(efficiency, top, _CMP_GT_OQ),
+				_mm256_cmp_ps(efficiency, bottom, _CMP_LT_OQ)
+			),
+			rankable
+		);
+
+		int mask = _mm256_movemask_ps(candidates);
+		if (mask) {
+			alignas(32) float lanes[8];
+			_mm256_store_ps(lanes, efficiency);
+			for (; mask; mask &= mask - 1) {
+				const int lane = __builtin_ctz(mask);
+				pass.offer(static_cast<DeviceId>(i + lane), lanes[lane]);
+			}
+		}
+	}
+
+	alignas(32) double sums[2][4];
+	_mm256_store_pd(sums[0], powerIn);
+	_mm256_store_pd(sums[1], powerOut);
+	for (size_t lane = 0; lane < 4u; lane++) {
+		pass.powerIn += sums[0][lane];
+		pass.powerOut += sums[1][lane];
+	}
+
+	pass.scalar(i, columns.size);
+}
+
+#endif
+
+#ifdef SM72445_FLEET_NEON
+
+static inline float32x4_t loadNeon(const Columns &columns, uint8_t property, size_t i) {
+	const uint32x4_t counts = vmovl_u16(vld1_u16(columns.counts[property] + i));
+	return vmulq_f32(vcvtq_f32_u32(counts), vld1q_f32(columns.scales[property] + i));
+}
+
+static inline float32x4_t maskNeon(float32x4_t value, uint32x4_t mask) {
+	return vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(value), mask));
+}
+
+static void evaluateNeon(FleetPass &pass) {
+	const Columns &columns = pass.columns;
+	const Outputs &outputs = pass.outputs;
+
+	float64x2_t powerIn = vdupq_n_f64(0.0), powerOut = vdupq_n_f64(0.0);
+
+	size_t i = 0u;
+	for (; i + 4u <= columns.size; i += 4u) {
+		const uint32_t statuses[4] = {
+			columns.status[i],
+			columns.status[i + 1u],
+			columns.status[i + 2u],
+			columns.status[i + 3u],
+		};
+		const uint32x4_t valid =
+			vtstq_u32(vld1q_u32(statuses), vdupq_n_u32(FleetState::VALID));
+
+		const float32x4_t pIn = maskNeon(
+			vmulq_f32(loadNeon(columns, V_IN, i), loadNeon(columns, I_IN, i)),
+			valid
+		);
+		const float32x4_t pOut = maskNeon(
+			vmulq_f32(loadNeon(columns, V_OUT, i), loadNeon(columns, I_OUT, i)),
+			valid
+		);
+		const uint32x4_t  rankable	 = vcgtq_f32(pIn, vdupq_n_f32(0.0f));
+		const float32x4_t efficiency = maskNeon(vdivq_f32(pOut, pIn), rankable);
+
+		powerIn	 = vaddq_f64(powerIn, vcvt_f64_f32(vget_low_f32(pIn)));
+		powerIn	 = vaddq_f64(powerIn, vcvt_high_f64_f32(pIn));
+		powerOut = vaddq_f64(powerOut, vcvt_f64_f32(vget_low_f32(pOut)));
+		powerOut = vaddq_f64(powerOut, vcvt_high_f64_f32(pOut));
+		pass.devices += vaddvq_u32(vshrq_n_u32(valid, 31));
+
+		if (outputs.powerIn) vst1q_f32(outputs.powerIn + i, pIn);
+		if (outputs.powerOut) vst1q_f32(outputs.powerOut + i, pOut);
+		if (outputs.efficiency) vst1q_f32(outputs.efficiency + i, efficiency);
+
+		const uint32x4_t candidates = vandq_u32(
+			vorrq_u32(
+				vcgtq_f32(efficiency, vdupq_n_f32(pass.topThreshold)),
+				vcltq_f32(efficiency, vdupq_n_f32(pass.bottomThreshold))
+			),
+			rankable
+		);
+
+		if (vmaxvq_u32(candidates)) {
+			uint32_t masks[4];
+			float	 lanes[4];
+			vst1q_u32(masks, candidates);
+			vst1q_f32(lanes, efficiency);
+			for (size_t lane = 0; lane < 4u; lane++)
+				if (masks[lane]) pass.offer(static_cast<DeviceId>(i + lane), lanes[lane]);
+		}
+	}
+
+	pass.powerIn += vaddvq_f64(powerIn);
+	pass.powerOut += vaddvq_f64(powerOut);
+
+	pass.scalar(i, columns.size);
+}
+
+#endif
+
+bool FleetKernels::isSupported(InstructionSet instructionSet) {
+	switch (instructionSet) {
+	case InstructionSet::SCALAR:
+		return true;
+#ifdef SM72445_FLEET_AVX2
+	case InstructionSet::AVX2:
+		return __builtin_cpu_supports("avx2");
+#endif
+#ifdef SM72445_FLEET_NEON
+	case InstructionSet::NEON:
+		return true;
+#endif
+	default:
+		return false;
+	}
+}
+
+static InstructionSet getBestInstructionSet(void) {
+	for (auto instructionSet : {InstructionSet::AVX2, InstructionSet::NEON})
+		if (FleetKernels::isSupported(instructionSet)) return instructionSet;
+	return InstructionSet::SCALAR;
+}
+
+static std::atomic<InstructionSet> selected{getBestInstructionSet()};
+
+InstructionSet FleetKernels::getInstructionSet(void) {
+	return selected.load(std::memory_order_relaxed);
+}
+
+bool FleetKernels::setInstructionSet(InstructionSet instructionSet) {
+	if (!isSupported(instructionSet)) return false;
+
+	selected.store(instructionSet, std::memory_order_relaxed);
+	return true;
+}
+
+Summary FleetKernels::evaluate(const Columns &columns, const Outputs &outputs) {
+	FleetPass pass{columns, outputs};
+
+	switch (getInstructionSet()) {
+#ifdef SM72445_FLEET_AVX2
+	case InstructionSet::AVX2:
+		evaluateAvx2(pass);
+		break;
+#endif
+#ifdef SM72445_FLEET_NEON
+	case InstructionSet::NEON:
+		evaluateNeon(pass);
+		break;
+#endif
+	default:
+		pass.scalar(0u, columns.size);
+		break;
+	}
+
+	return pass.getSummary();
+}
+
+Summary FleetKernels::evaluate(const FleetState &fleet, const Outputs &outputs) {
+	return evaluate(fleet.getColumns(), outputs);
+}
+
+float FleetKernels::Summary::getEfficiency(void) const {
+	if (this->powerIn <= 0.0) return 0.0f;
+	return static_cast<float>(this->powerOut / this->powerIn);
+}
@@ -0,0 +1,148 @@
+/**
+ ******************************************************************************
+ * @file			: SM72445_FleetState.cpp
+ * @brief			: Source for SM72445_FleetState.hpp
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "SM72445_FleetState.hpp"
+
+#include <algorithm>
+
+using DeviceId			 = FleetState::DeviceId;
+using ElectricalProperty = FleetState::ElectricalProperty;
+using Columns			 = FleetState::Columns;
+using Reg1				 = SM72445::Reg1;
+
+static constexpr array<ElectricalProperty, FleetState::PROPERTIES> properties = {
+	ElectricalProperty::CURRENT_IN,
+	ElectricalProperty::VOLTAGE_IN,
+	ElectricalProperty::CURRENT_OUT,
+	ElectricalProperty::VOLTAGE_OUT,
+};
+
+void FleetState::reserve(size_t devices) {
+	this->devices.reserve(devices);
+	this->calibrations.reserve(devices);
+	for (auto &column : this->counts) column.reserve(devices);
+	for (auto &column : this->scales) column.reserve(devices);
+	this->status.reserve(devices);
+}
+
+DeviceId FleetState::add(const SM72445_X &device) {
+	const DeviceId id = static_cast<DeviceId>(this->devices.size());
+
+	this->devices.push_back(&device);
+	this->calibrations.push_back(device.getCalibration());
+	for (auto &column : this->counts) column.push_back(0u);
+	for (auto &column : this->scales) column.push_back(0.0f);
+	this->status.push_back(0u);
+
+	updateScales(id);
+	return id;
+}
+
+void FleetState::updateScales(DeviceId id) {
+	if (id >= size()) return;
+
+	const SM72445_X &device = *this->devices[id];
+
+	// Record before converting, so that a concurrent replacement is seen next poll.
+	this->calibrations[id] = device.getCalibration();
+
+	// Converting a count of one in every field yields each property's scale factor.
+	const auto unit = device.convertElectricalMeasurements(Reg1(1u, 1u, 1u, 1u));
+
+	for (auto property : properties) {
+		const uint8_t index		= static_cast<uint8_t>(property);
+		this->scales[index][id] = unit ? (*unit)[index] : 0.0f;
+	}
+}
+
+size_t FleetState::size(void) const { return this->devices.size(); }
+
+size_t FleetState::clip(DeviceId first, size_t count) const {
+	if (first >= size()) return 0u;
+	return std::min(count, size() - first);
+}
+
+void FleetState::update(DeviceId id, const optional<Reg1> &reg1) {
+	if (id >= size()) return;
+
+	if (!reg1) {
+		this->status[id] |= FAILED;
+		return;
+	}
+
+	for (auto property : properties) {
+		const uint8_t index		= static_cast<uint8_t>(property);
+		this->counts[index][id] = (*reg1)[property];
+	}
+	this->status[id] = VALID;
+}
+
+void FleetState::update(DeviceId first, const optional<Reg1> *samples, size_t count) {
+	count = clip(first, count);
+	for (size_t i = 0; i < count; i++) update(first + i, samples[i]);
+}
+
+size_t FleetState::poll(DeviceId first, size_t count) {
+	count = clip(first, count);
+
+	size_t succeeded = 0u;
+	for (size_t i = 0; i < count; i++) {
+		const SM72445_X &device = *this->devices[first + i];
+		if (!(device.getCalibration() == this->calibrations[first + i])) {
+			updateScales(first + i);
+		}
+
+		const auto reg1 = device.getElectricalMeasurementsRegister();
+		update(first + i, reg1);
+		if (reg1) succeeded++;
+	}
+	return succeeded;
+}
+
+void FleetState::convert(
+	ElectricalProperty property,
+	float			  *out,
+	DeviceId		   first,
+	size_t			   count
+) const {
+	const uint8_t index = static_cast<uint8_t>(property);
+	if (index >= PROPERTIES) return;
+
+	count = clip(first, count);
+
+	const uint16_t *counts = this->counts[index].data() + first;
+	const float	   *scales = this->scales[index].data() + first;
+	for (size_t i = 0; i < count; i++) out[i] = counts[i] * scales[i];
+}
+
+Reg1 FleetState::getCounts(DeviceId id) const {
+	if (id >= size()) return Reg1(0u, 0u, 0u, 0u);
+
+	return Reg1(
+		this->counts[static_cast<uint8_t>(ElectricalProperty::CURRENT_IN)][id],
+		this->counts[static_cast<uint8_t>(ElectricalProperty::VOLTAGE_IN)][id],
+		this->counts[static_cast<uint8_t>(ElectricalProperty::CURRENT_OUT)][id],
+		this->counts[static_cast<uint8_t>(ElectricalProperty::VOLTAGE_OUT)][id]
+	);
+}
+
+uint8_t FleetState::getStatus(DeviceId id) const {
+	if (id >= size()) return 0u;
+	return this->status[id];
+}
+
+Columns FleetState::getColumns(void) const {
+	Columns columns{};
+	for (size_t i = 0; i < PROPERTIES; i++) {
+		columns.counts[i] = this->counts[i].data();
+		columns.scales[i] = this->scales[i].data();
+	}
+	columns.status = this->status.data();
+	columns.size   = size();
+	return columns;
+}
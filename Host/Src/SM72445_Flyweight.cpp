@@ -0,0 +1,68 @@
+/**
+ ******************************************************************************
+ * @file			: SM72445_Flyweight.cpp
+ * @brief			: Source for SM72445_Flyweight.hpp
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "SM72445_Flyweight.hpp"
+
+using DeviceAddress = SM72445::DeviceAddress;
+using Profile		= DeviceDirectory::Profile;
+
+using std::nullopt;
+
+optional<uint8_t> DeviceDirectory::addBus(SM72445::I2C &i2c) {
+	if (this->buses.size() >= MAX_BUSES) return nullopt;
+
+	this->buses.push_back(&i2c);
+	return static_cast<uint8_t>(this->buses.size() - 1u);
+}
+
+optional<uint16_t> DeviceDirectory::intern(const Profile &profile) {
+	// A fleet has a handful of profiles, so a linear search beats any index.
+	for (size_t i = 0; i < this->profiles.size(); i++) {
+		if (this->profiles[i] == profile) return static_cast<uint16_t>(i);
+	}
+
+	if (this->profiles.size() >= MAX_PROFILES) return nullopt;
+
+	this->profiles.push_back(profile);
+	return static_cast<uint16_t>(this->profiles.size() - 1u);
+}
+
+optional<DeviceHandle> DeviceDirectory::makeHandle(
+	uint8_t		   bus,
+	DeviceAddress  deviceAddress,
+	const Profile &profile
+) {
+	if (bus >= this->buses.size()) return nullopt;
+
+	const auto index = intern(profile);
+	if (!index) return nullopt;
+
+	return DeviceHandle{bus, deviceAddress, *index};
+}
+
+optional<SM72445_X> DeviceDirectory::resolve(DeviceHandle handle) const {
+	const Profile *profile = getProfile(handle);
+	if (!profile) return nullopt;
+
+	// Constructed in place: a copy of the device would own a copy of the profile.
+	return optional<SM72445_X>(
+		std::in_place,
+		*this->buses[handle.bus],
+		handle.deviceAddress,
+		profile
+	);
+}
+
+const Profile *DeviceDirectory::getProfile(DeviceHandle handle) const {
+	if (handle.bus >= this->buses.size()) return nullptr;
+	if (handle.profile >= this->profiles.size()) return nullptr;
+
+	return &this->profiles[handle.profile];
+}
+
+size_t DeviceDirectory::getProfileCount(void) const { return this->profiles.size(); }
@@ -0,0 +1,183 @@
+/**
+ ******************************************************************************
+ * @file			: SM72445_Instrumented.cpp
+ * @brief			: Source for SM72445_Instrumented.hpp
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "SM72445_Instrumented.hpp"
+
+#include <chrono>
+
+using Register		= SM72445::Register;
+using DeviceAddress = SM72445::DeviceAddress;
+using MemoryAddress = SM72445::MemoryAddress;
+using Stats			= InstrumentedI2C::Stats;
+
+struct InstrumentedI2C::Cell {
+	std::atomic<uint64_t> reads{0u};
+	std::atomic<uint64_t> writes{0u};
+	std::atomic<uint64_t> failures{0u};
+	std::atomic<uint64_t> bytes{0u};
+	std::atomic<uint64_t> nanoseconds{0u};
+	std::atomic<uint64_t> latency[BUCKETS] = {};
+};
+
+static constexpr size_t CELLS = 8u * 8u;
+
+static uint64_t getSteadyNanoseconds(void) {
+	const auto now = std::chrono::steady_clock::now().time_since_epoch();
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(now).count();
+}
+
+uint64_t Stats::getCalls(void) const { return this->reads + this->writes; }
+
+uint64_t Stats::getLatencyQuantile(float quantile) const {
+	const uint64_t calls = getCalls();
+	if (calls == 0u) return 0u;
+
+	// Rank of the quantile, rounded up so that e.g. the 0.5 quantile of one call is it.
+	uint64_t rank = uint64_t(quantile * float(calls));
+	if (float(rank) < quantile * float(calls)) rank++;
+	if (rank == 0u) rank = 1u;
+
+	uint64_t seen = 0u;
+	for (size_t bucket = 0; bucket < BUCKETS; bucket++) {
+		seen += this->latency[bucket];
+		if (seen >= rank) return getBucketUpperBound(bucket);
+	}
+	return getBucketUpperBound(BUCKETS - 1u);
+}
+
+Stats &Stats::operator+=(const Stats &other) {
+	this->reads		  += other.reads;
+	this->writes	  += other.writes;
+	this->failures	  += other.failures;
+	this->bytes		  += other.bytes;
+	this->nanoseconds += other.nanoseconds;
+	for (size_t i = 0; i < BUCKETS; i++) this->latency[i] += other.latency[i];
+	return *this;
+}
+
+size_t InstrumentedI2C::getBucket(uint64_t nanoseconds) {
+	if (nanoseconds < (1u << SUB_BUCKET_BITS)) return size_t(nanoseconds);
+
+	const uint8_t exponent = 63u - __builtin_clzll(nanoseconds);
+	if (exponent >= MAX_EXPONENT) return BUCKETS - 1u;
+
+	const uint8_t shift	   = exponent - SUB_BUCKET_BITS;
+	const size_t  subIndex = (nanoseconds >> shift) & ((1u << SUB_BUCKET_BITS) - 1u);
+	return ((size_t(shift) + 1u) << SUB_BUCKET_BITS) + subIndex;
+}
+
+uint64_t InstrumentedI2C::getBucketUpperBound(size_t bucket) {
+	if (bucket < (1u << SUB_BUCKET_BITS)) return bucket;
+	if (bucket >= BUCKETS - 1u) return UINT64_MAX;
+
+	const uint8_t  shift	= uint8_t(bucket >> SUB_BUCKET_BITS) - 1u;
+	const uint64_t mantissa = (bucket & ((1u << SUB_BUCKET_BITS) - 1u))
+							| (1u << SUB_BUCKET_BITS);
+	return ((mantissa + 1u) << shift) - 1u;
+}
+
+InstrumentedI2C::InstrumentedI2C(SM72445::I2C &i2c, Clock clock)
+	: i2c{i2c}, clock{clock ? clock : getSteadyNanoseconds}, cells{new Cell[CELLS]} {}
+
+InstrumentedI2C::~InstrumentedI2C() = default;
+
+InstrumentedI2C::Cell &InstrumentedI2C::getCell(
+	DeviceAddress deviceAddress, //
+	MemoryAddress memoryAddress
+) const {
+	const uint8_t device   = static_cast<uint8_t>(deviceAddress) & 0x7u;
+	const uint8_t regIndex = static_cast<uint8_t>(memoryAddress) & 0x7u;
+	return this->cells[device * 8u + regIndex];
+}
+
+void InstrumentedI2C::record(
+	DeviceAddress deviceAddress,
+	MemoryAddress memoryAddress,
+	bool		  isWrite,
+	bool		  success,
+	uint64_t	  nanoseconds
+) {
+	Cell &cell = getCell(deviceAddress, memoryAddress);
+
+	(isWrite ? cell.writes : cell.reads).fetch_add(1u, std::memory_order_relaxed);
+	if (success) cell.bytes.fetch_add(BYTES_PER_TRANSACTION, std::memory_order_relaxed);
+	else cell.failures.fetch_add(1u, std::memory_order_relaxed);
+
+	cell.nanoseconds.fetch_add(nanoseconds, std::memory_order_relaxed);
+	cell.latency[getBucket(nanoseconds)].fetch_add(1u, std::memory_order_relaxed);
+}
+
+optional<Register> InstrumentedI2C::read(
+	DeviceAddress deviceAddress, //
+	MemoryAddress memoryAddress
+) {
+	const uint64_t start = this->clock();
+	auto		   data	 = this->i2c.read(deviceAddress, memoryAddress);
+	const uint64_t end	 = this->clock();
+
+	record(deviceAddress, memoryAddress, false, data.has_value(), end - start);
+	return data;
+}
+
+optional<Register> InstrumentedI2C::write(
+	DeviceAddress deviceAddress,
+	MemoryAddress memoryAddress,
+	Register	  data
+) {
+	const uint64_t start   = this->clock();
+	auto		   written = this->i2c.write(deviceAddress, memoryAddress, data);
+	const uint64_t end	   = this->clock();
+
+	record(deviceAddress, memoryAddress, true, written.has_value(), end - start);
+	return written;
+}
+
+Stats InstrumentedI2C::snapshot(DeviceAddress deviceAddress, MemoryAddress memoryAddress)
+	const {
+	const Cell &cell = getCell(deviceAddress, memoryAddress);
+	Stats		stats{};
+
+	stats.reads		  = cell.reads.load(std::memory_order_relaxed);
+	stats.writes	  = cell.writes.load(std::memory_order_relaxed);
+	stats.failures	  = cell.failures.load(std::memory_order_relaxed);
+	stats.bytes		  = cell.bytes.load(std::memory_order_relaxed);
+	stats.nanoseconds = cell.nanoseconds.load(std::memory_order_relaxed);
+	for (size_t i = 0; i < BUCKETS; i++) {
+		stats.latency[i] = cell.latency[i].load(std::memory_order_relaxed);
+	}
+	return stats;
+}
+
+Stats InstrumentedI2C::snapshot(MemoryAddress memoryAddress) const {
+	Stats stats{};
+	for (uint8_t device = 0u; device < 8u; device++) {
+		stats += snapshot(static_cast<DeviceAddress>(device), memoryAddress);
+	}
+	return stats;
+}
+
+Stats InstrumentedI2C::snapshot(void) const {
+	Stats stats{};
+	for (uint8_t regIndex = 0u; regIndex < 8u; regIndex++) {
+		stats += snapshot(static_cast<MemoryAddress>(0xE0u | regIndex));
+	}
+	return stats;
+}
+
+void InstrumentedI2C::reset(void) {
+	for (size_t i = 0; i < CELLS; i++) {
+		Cell &cell = this->cells[i];
+
+		cell.reads.store(0u, std::memory_order_relaxed);
+		cell.writes.store(0u, std::memory_order_relaxed);
+		cell.failures.store(0u, std::memory_order_relaxed);
+		cell.bytes.store(0u, std::memory_order_relaxed);
+		cell.nanoseconds.store(0u, std::memory_order_relaxed);
+		for (auto &bucket : cell.latency) bucket.store(0u, std::memory_order_relaxed);
+	}
+}
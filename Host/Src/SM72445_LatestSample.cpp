@@ -0,0 +1,46 @@
+/**
+ ******************************************************************************
+ * @file			: SM72445_LatestSample.cpp
+ * @brief			: Source for SM72445_LatestSample.hpp
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "SM72445_LatestSample.hpp"
+
+#include <chrono>
+
+using Register = SM72445::Register;
+using Reg1	   = SM72445::Reg1;
+using Sample   = LatestSample::Sample;
+
+using std::nullopt;
+
+LatestSample::LatestSample() : cell{}, count{0u} {}
+
+optional<Reg1> LatestSample::update(const SM72445 &sm72445) {
+	auto reg1 = sm72445.getElectricalMeasurementsRegister();
+	if (reg1) store(*reg1);
+	return reg1;
+}
+
+void LatestSample::store(const Reg1 &reg1) {
+	const auto now		 = std::chrono::steady_clock::now().time_since_epoch();
+	const auto timestamp = std::chrono::duration_cast<std::chrono::nanoseconds>(now);
+
+	this->cell.store(Sample{Register(reg1), uint64_t(timestamp.count()), ++this->count});
+}
+
+optional<Sample> LatestSample::load(void) const {
+	const Sample sample = this->cell.load();
+
+	if (sample.count == 0u) return nullopt;
+	return sample;
+}
+
+optional<Reg1> LatestSample::getElectricalMeasurementsRegister(void) const {
+	auto sample = load();
+
+	if (!sample) return nullopt;
+	return Reg1(sample->reg1);
+}
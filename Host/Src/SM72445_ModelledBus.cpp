@@ -0,0 +1,95 @@
+/**
+ ******************************************************************************
+ * @file			: SM72445_ModelledBus.cpp
+ * @brief			: Source for SM72445_ModelledBus.hpp
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "SM72445_ModelledBus.hpp"
+
+using Register		= SM72445::Register;
+using DeviceAddress = SM72445::DeviceAddress;
+using MemoryAddress = SM72445::MemoryAddress;
+using ClockRate		= ModelledBusI2C::ClockRate;
+
+/**
+ * @brief Get the minimum bus free time between a STOP and START (tBUF), in nanoseconds.
+ */
+static uint32_t getBusFreeTime(ClockRate clockRate) {
+	switch (clockRate) {
+	case ClockRate::STANDARD:
+		return 4'700u;
+	case ClockRate::FAST:
+		return 1'300u;
+	case ClockRate::FAST_PLUS:
+	default:
+		return 500u;
+	}
+}
+
+ModelledBusI2C::ModelledBusI2C(
+	SM72445::I2C &i2c,
+	ClockRate	  clockRate,
+	uint32_t	  clockStretch
+)
+	: i2c{i2c},
+	  clockRate{clockRate},
+	  clockStretch{clockStretch},
+	  now{0u},
+	  busy{0u},
+	  transactions{0u} {}
+
+uint64_t ModelledBusI2C::getTransactionTime(uint32_t clocks) const {
+	const uint64_t hertz = static_cast<uint32_t>(this->clockRate);
+	const uint64_t wire	 = (uint64_t(clocks) * 1'000'000'000u + hertz - 1u) / hertz;
+
+	return wire + getBusFreeTime(this->clockRate) + this->clockStretch;
+}
+
+void ModelledBusI2C::account(uint32_t clocks) {
+	const uint64_t time	 = getTransactionTime(clocks);
+	this->now			+= time;
+	this->busy			+= time;
+	this->transactions++;
+}
+
+optional<Register> ModelledBusI2C::read(
+	DeviceAddress deviceAddress, //
+	MemoryAddress memoryAddress
+) {
+	auto data = this->i2c.read(deviceAddress, memoryAddress);
+
+	account(data ? READ_CLOCKS : FAILED_CLOCKS);
+	return data;
+}
+
+optional<Register> ModelledBusI2C::write(
+	DeviceAddress deviceAddress,
+	MemoryAddress memoryAddress,
+	Register	  data
+) {
+	auto written = this->i2c.write(deviceAddress, memoryAddress, data);
+
+	account(written ? WRITE_CLOCKS : FAILED_CLOCKS);
+	return written;
+}
+
+void ModelledBusI2C::advance(uint64_t nanoseconds) { this->now += nanoseconds; }
+
+uint64_t ModelledBusI2C::getTime(void) const { return this->now; }
+
+uint64_t ModelledBusI2C::getBusyTime(void) const { return this->busy; }
+
+uint64_t ModelledBusI2C::getTransactionCount(void) const { return this->transactions; }
+
+float ModelledBusI2C::getUtilisation(void) const {
+	if (this->now == 0u) return 0.0f;
+	return float(this->busy) / float(this->now);
+}
+
+void ModelledBusI2C::reset(void) {
+	this->now		   = 0u;
+	this->busy		   = 0u;
+	this->transactions = 0u;
+}
@@ -0,0 +1,247 @@
+/**
+ ******************************************************************************
+ * @file			: SM72445_Registry.cpp
+ * @brief			: Source for SM72445_Registry.hpp
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "SM72445_Registry.hpp"
+
+#include <algorithm>
+
+using DeviceId		= DeviceRegistry::DeviceId;
+using DeviceAddress = DeviceRegistry::DeviceAddress;
+using Calibration	= DeviceRegistry::Calibration;
+using Member		= DeviceRegistry::Member;
+using Snapshot		= DeviceRegistry::Snapshot;
+using Range			= Snapshot::Range;
+using Guard			= DeviceRegistry::Guard;
+using Reader		= DeviceRegistry::Reader;
+
+using std::nullopt;
+
+/*
+ * Every pin, publish and epoch access is sequentially consistent. A reader that loads a
+ * snapshot before it is replaced has therefore published an epoch no later than the one
+ * the snapshot is retired in, and a reader pinning a later epoch loads its replacement.
+ */
+
+/**
+ * @brief The description of a member, from which snapshots are built.
+ */
+struct DeviceRegistry::Placement {
+	DeviceId	  id;
+	uint8_t		  bus;
+	DeviceAddress deviceAddress;
+	Calibration	  calibration;
+};
+
+Range Snapshot::getMembers(void) const {
+	return Range{this->members.data(), this->members.data() + this->members.size()};
+}
+
+Range Snapshot::getBus(uint8_t bus) const {
+	if (size_t(bus) + 1u >= this->offsets.size()) return Range{nullptr, nullptr};
+
+	const Member *members = this->members.data();
+	return Range{members + this->offsets[bus], members + this->offsets[bus + 1u]};
+}
+
+const Member *Snapshot::find(DeviceId id) const {
+	for (const Member &member : this->members) {
+		if (member.id == id) return &member;
+	}
+	return nullptr;
+}
+
+uint64_t Snapshot::getVersion(void) const { return this->version; }
+
+Guard::Guard(std::atomic<uint64_t> &slot, const Snapshot &snapshot)
+	: slot{&slot}, //
+	  snapshot{&snapshot} {}
+
+Guard::Guard(Guard &&other) noexcept
+	: slot{other.slot}, //
+	  snapshot{other.snapshot} {
+	other.slot = nullptr;
+}
+
+Guard::~Guard() {
+	if (this->slot) this->slot->store(0u, std::memory_order_seq_cst);
+}
+
+Reader::Reader(DeviceRegistry &registry, ReaderSlot &slot)
+	: registry{&registry}, //
+	  slot{&slot} {}
+
+Reader::Reader(Reader &&other) noexcept
+	: registry{other.registry}, //
+	  slot{other.slot} {
+	other.slot = nullptr;
+}
+
+Reader::~Reader() {
+	if (this->slot) this->slot->claimed.store(false, std::memory_order_release);
+}
+
+Guard Reader::pin(void) const {
+	std::atomic<uint64_t> &epoch = this->slot->epoch;
+
+	epoch.store(this->registry->epoch.load(std::memory_order_seq_cst));
+	const Snapshot *snapshot = this->registry->current.load(std::memory_order_seq_cst);
+
+	return Guard(epoch, *snapshot);
+}
+
+DeviceRegistry::DeviceRegistry(std::vector<SM72445::I2C *> buses)
+	: buses{std::move(buses)}, //
+	  current{nullptr},		   //
+	  epoch{1u} {
+	publish({});
+}
+
+DeviceRegistry::~DeviceRegistry() {
+	for (const Retired &retired : this->retired) delete retired.snapshot;
+	delete this->current.load();
+}
+
+optional<Reader> DeviceRegistry::addReader(void) {
+	for (ReaderSlot &slot : this->slots) {
+		bool expected = false;
+		if (slot.claimed.compare_exchange_strong(expected, true)) {
+			return Reader(*this, slot);
+		}
+	}
+	return nullopt;
+}
+
+bool DeviceRegistry::add(
+	DeviceId		   id,
+	uint8_t			   bus,
+	DeviceAddress	   deviceAddress,
+	const Calibration &calibration
+) {
+	std::lock_guard<std::mutex> lock{this->mutex};
+
+	const Snapshot &snapshot = *this->current.load();
+	if (bus >= this->buses.size() || snapshot.find(id)) return false;
+
+	auto placements = getPlacements(snapshot);
+	placements.push_back(Placement{id, bus, deviceAddress, calibration});
+	publish(std::move(placements));
+	return true;
+}
+
+bool DeviceRegistry::remove(DeviceId id) {
+	std::lock_guard<std::mutex> lock{this->mutex};
+
+	auto placements = getPlacements(*this->current.load());
+	for (size_t i = 0; i < placements.size(); i++) {
+		if (placements[i].id != id) continue;
+
+		placements.erase(placements.begin() + i);
+		publish(std::move(placements));
+		return true;
+	}
+	return false;
+}
+
+bool DeviceRegistry::move(DeviceId id, uint8_t bus, DeviceAddress deviceAddress) {
+	std::lock_guard<std::mutex> lock{this->mutex};
+
+	if (bus >= this->buses.size()) return false;
+
+	auto placements = getPlacements(*this->current.load());
+	for (Placement &placement : placements) {
+		if (placement.id != id) continue;
+
+		placement.bus			= bus;
+		placement.deviceAddress = deviceAddress;
+		publish(std::move(placements));
+		return true;
+	}
+	return false;
+}
+
+size_t DeviceRegistry::reclaim(void) {
+	std::lock_guard<std::mutex> lock{this->mutex};
+
+	return reclaimRetired();
+}
+
+size_t DeviceRegistry::getBusCount(void) const { return this->buses.size(); }
+
+std::vector<DeviceRegistry::Placement> DeviceRegistry::getPlacements(
+	const Snapshot &snapshot
+) {
+	std::vector<Placement> placements;
+	placements.reserve(snapshot.getMembers().size() + 1u);
+	for (const Member &member : snapshot.getMembers()) {
+		placements.push_back(
+			{member.id,
+			 member.bus,
+			 member.device.getDeviceAddress(),
+			 member.device.getCalibration()}
+		);
+	}
+	return placements;
+}
+
+void DeviceRegistry::publish(std::vector<Placement> placements) {
+	std::sort(
+		placements.begin(),
+		placements.end(),
+		[](const Placement &a, const Placement &b) {
+			return a.bus != b.bus ? a.bus < b.bus : a.id < b.id;
+		}
+	);
+
+	// Everything is built before publishing, so that pins only ever see whole snapshots.
+	Snapshot *snapshot = new Snapshot();
+	snapshot->members.reserve(placements.size());
+	snapshot->offsets.assign(this->buses.size() + 1u, 0u);
+	for (const Placement &placement : placements) {
+		SM72445::I2C &i2c = *this->buses[placement.bus];
+		snapshot->members.push_back(
+			Member{
+				placement.id,
+				placement.bus,
+				SM72445_X(i2c, placement.deviceAddress, placement.calibration),
+			}
+		);
+		snapshot->offsets[placement.bus + 1u]++;
+	}
+	for (size_t bus = 1; bus < snapshot->offsets.size(); bus++) {
+		snapshot->offsets[bus] += snapshot->offsets[bus - 1u];
+	}
+
+	const Snapshot *previous = this->current.load(std::memory_order_relaxed);
+	snapshot->version		 = previous ? previous->version + 1u : 0u;
+
+	this->current.store(snapshot, std::memory_order_seq_cst);
+	if (!previous) return;
+
+	const uint64_t epoch = this->epoch.fetch_add(1u, std::memory_order_seq_cst);
+	this->retired.push_back(Retired{previous, epoch});
+	reclaimRetired();
+}
+
+size_t DeviceRegistry::reclaimRetired(void) {
+	uint64_t oldest = UINT64_MAX; // The earliest epoch any reader remains pinned from.
+	for (const ReaderSlot &slot : this->slots) {
+		const uint64_t epoch = slot.epoch.load(std::memory_order_seq_cst);
+		if (epoch != 0u) oldest = std::min(oldest, epoch);
+	}
+
+	const auto reclaimable = [oldest](const Retired &retired) {
+		if (retired.epoch >= oldest) return false;
+		delete retired.snapshot;
+		return true;
+	};
+	this->retired.erase(
+		std::remove_if(this->retired.begin(), this->retired.end(), reclaimable),
+		this->retired.end()
+	);
+	return this->retired.size();
+}
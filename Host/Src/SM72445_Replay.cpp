@@ -0,0 +1,235 @@
+/**
+ ******************************************************************************
+ * @file			: SM72445_Replay.cpp
+ * @brief			: Source for SM72445_Replay.hpp
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "SM72445_Replay.hpp"
+
+#include <ios>
+#include <sstream>
+#include <string>
+#include <thread>
+
+using Register		= SM72445::Register;
+using DeviceAddress = SM72445::DeviceAddress;
+using MemoryAddress = SM72445::MemoryAddress;
+using Operation		= I2CLog::Operation;
+
+using std::nullopt;
+
+void I2CLog::save(std::ostream &stream) const {
+	const auto flags = stream.flags();
+
+	for (const auto &entry : this->entries) {
+		stream << std::dec << entry.timestamp << ' '
+			   << (entry.operation == Operation::READ ? 'R' : 'W') << ' ' << std::hex
+			   << static_cast<unsigned>(entry.deviceAddress) << ' '
+			   << static_cast<unsigned>(entry.memoryAddress) << ' ';
+
+		if (entry.data) stream << *entry.data;
+		else stream << '-';
+
+		stream << '\n';
+	}
+
+	stream.flags(flags);
+}
+
+static inline bool isValidDeviceAddress(unsigned deviceAddress) {
+	// ADDR000 is not supported by the SM72445.
+	return deviceAddress >= 0x1u && deviceAddress <= 0x7u;
+}
+
+static inline bool isValidMemoryAddress(unsigned memoryAddress) {
+	if (memoryAddress > 0xFFu) return false;
+
+	switch (static_cast<MemoryAddress>(memoryAddress)) {
+	case MemoryAddress::REG0:
+	case MemoryAddress::REG1:
+	case MemoryAddress::REG3:
+	case MemoryAddress::REG4:
+	case MemoryAddress::REG5:
+		return true;
+	}
+	return false;
+}
+
+optional<I2CLog> I2CLog::load(std::istream &stream) {
+	I2CLog		log;
+	std::string line;
+	uint64_t	previous = 0u;
+
+	while (std::getline(stream, line)) {
+		if (line.empty()) continue;
+
+		std::istringstream fields(line);
+		Entry			   entry;
+		char			   operation;
+		unsigned		   deviceAddress, memoryAddress;
+		std::string		   data;
+
+		fields >> std::dec >> entry.timestamp >> operation >> std::hex >> deviceAddress
+			>> memoryAddress >> data;
+
+		if (!fields || (operation != 'R' && operation != 'W')) return nullopt;
+		if (!(fields >> std::ws).eof()) return nullopt; // Trailing text, e.g. misaligned.
+		if (!isValidDeviceAddress(deviceAddress)) return nullopt;
+		if (!isValidMemoryAddress(memoryAddress)) return nullopt;
+
+		// Replay pacing is relative to the first entry, so time may not run backwards.
+		if (entry.timestamp < previous) return nullopt;
+		previous = entry.timestamp;
+
+		entry.operation		= operation == 'R' ? Operation::READ : Operation::WRITE;
+		entry.deviceAddress = static_cast<DeviceAddress>(deviceAddress);
+		entry.memoryAddress = static_cast<MemoryAddress>(memoryAddress);
+
+		if (data == "-") entry.data = nullopt;
+		else {
+			std::istringstream value(data);
+			Register		   reg;
+			value >> std::hex >> reg;
+			if (!value || !(value >> std::ws).eof()) return nullopt;
+			entry.data = reg;
+		}
+
+		log.entries.push_back(entry);
+	}
+
+	return log;
+}
+
+RecordingI2C::RecordingI2C(SM72445::I2C &i2c) : i2c{i2c}, log{}, start{Clock::now()} {}
+
+static inline uint64_t microsecondsSince(std::chrono::steady_clock::time_point start) {
+	using std::chrono::duration_cast;
+	using std::chrono::microseconds;
+	return duration_cast<microseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+optional<Register> RecordingI2C::read(
+	DeviceAddress deviceAddress, //
+	MemoryAddress memoryAddress
+) {
+	auto data = this->i2c.read(deviceAddress, memoryAddress);
+	this->log.entries.push_back(
+		{microsecondsSince(this->start), //
+		 Operation::READ,
+		 deviceAddress,
+		 memoryAddress,
+		 data}
+	);
+	return data;
+}
+
+optional<Register> RecordingI2C::write(
+	DeviceAddress deviceAddress,
+	MemoryAddress memoryAddress,
+	Register	  data
+) {
+	auto written = this->i2c.write(deviceAddress, memoryAddress, data);
+	this->log.entries.push_back(
+		{microsecondsSince(this->start),
+		 Operation::WRITE,
+		 deviceAddress,
+		 memoryAddress,
+		 written}
+	);
+	return written;
+}
+
+const I2CLog &RecordingI2C::getLog(void) const {
+	return this->log;
+}
+
+void RecordingI2C::clear(void) {
+	this->log.entries.clear();
+	this->start = Clock::now();
+}
+
+static inline uint8_t deviceIndex(DeviceAddress deviceAddress) {
+	return static_cast<uint8_t>(deviceAddress) & 0x7u;
+}
+
+static inline uint8_t registerIndex(MemoryAddress memoryAddress) {
+	return static_cast<uint8_t>(memoryAddress) & 0x7u;
+}
+
+ReplayI2C::ReplayI2C(const I2CLog &log, Pacing pacing, bool loop)
+	: reads{}, writes{}, pacing{pacing}, loop{loop}, duration{0u}, start{nullopt} {
+	const uint64_t origin = log.entries.empty() ? 0u : log.entries.front().timestamp;
+
+	for (const auto &entry : log.entries) {
+		Streams &streams = entry.operation == Operation::READ ? this->reads : this->writes;
+		Stream	&stream	 = streams[deviceIndex(entry.deviceAddress)]
+								  [registerIndex(entry.memoryAddress)];
+
+		// Logs built in memory are not validated by load(); clamp rather than wrap.
+		const uint64_t timestamp = entry.timestamp > origin ? entry.timestamp - origin : 0u;
+		stream.samples.push_back({timestamp, entry.data});
+
+		if (timestamp > this->duration) this->duration = timestamp;
+	}
+}
+
+const ReplayI2C::Sample *ReplayI2C::next(Stream &stream) {
+	if (stream.cursor >= stream.samples.size()) {
+		if (!this->loop || stream.samples.empty()) return nullptr;
+		stream.cursor = 0u;
+		stream.lap++;
+	}
+
+	const Sample &sample = stream.samples[stream.cursor++];
+
+	if (this->pacing == Pacing::REAL_TIME) {
+		if (!this->start) this->start = Clock::now();
+
+		const uint64_t offset = stream.lap * (this->duration + 1u) + sample.timestamp;
+		std::this_thread::sleep_until(*this->start + std::chrono::microseconds(offset));
+	}
+
+	return &sample;
+}
+
+optional<Register> ReplayI2C::read(
+	DeviceAddress deviceAddress, //
+	MemoryAddress memoryAddress
+) {
+	const Sample *sample = next(
+		this->reads[deviceIndex(deviceAddress)][registerIndex(memoryAddress)]
+	);
+
+	if (!sample) return nullopt;
+	return sample->data;
+}
+
+optional<Register> ReplayI2C::write(
+	DeviceAddress deviceAddress,
+	MemoryAddress memoryAddress,
+	Register	  data
+) {
+	Stream &stream = this->writes[deviceIndex(deviceAddress)][registerIndex(memoryAddress)];
+
+	// Writes absent from the recording are simply acknowledged.
+	if (stream.samples.empty()) return data;
+
+	const Sample *sample = next(stream);
+
+	if (!sample || !sample->data) return nullopt;
+	return data;
+}
+
+void ReplayI2C::rewind(void) {
+	for (Streams *streams : {&this->reads, &this->writes}) {
+		for (auto &device : *streams) {
+			for (auto &stream : device) {
+				stream.cursor = 0u;
+				stream.lap	  = 0u;
+			}
+		}
+	}
+	this->start = nullopt;
+}
@@ -0,0 +1,269 @@
+/**
+ ******************************************************************************
+ * @file			: SM72445_Simulator.cpp
+ * @brief			: Source for SM72445_Simulator.hpp
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "SM72445_Simulator.hpp"
+
+#include <cmath>
+
+using Register		 = SM72445::Register;
+using DeviceAddress	 = SM72445::DeviceAddress;
+using MemoryAddress	 = SM72445::MemoryAddress;
+using Reg0			 = SM72445::Reg0;
+using Reg1			 = SM72445::Reg1;
+using Reg3			 = SM72445::Reg3;
+using Reg4			 = SM72445::Reg4;
+using Reg5			 = SM72445::Reg5;
+using OperatingPoint = SimulatedSM72445::OperatingPoint;
+
+using std::nullopt;
+
+SimulatedSM72445::SimulatedSM72445(const Gains &gains) : gains{gains}, devices{} {}
+
+SimulatedSM72445::Device *SimulatedSM72445::getDevice(DeviceAddress deviceAddress) {
+	Device &device = this->devices[static_cast<uint8_t>(deviceAddress) & 0x7u];
+	return device.present ? &device : nullptr;
+}
+
+const SimulatedSM72445::Device *SimulatedSM72445::getDevice(DeviceAddress deviceAddress
+) const {
+	const Device &device = this->devices[static_cast<uint8_t>(deviceAddress) & 0x7u];
+	return device.present ? &device : nullptr;
+}
+
+void SimulatedSM72445::addDevice(
+	DeviceAddress deviceAddress,
+	const Panel	 &panel,
+	float		  vOut,
+	float		  efficiency
+) {
+	Device &device = this->devices[static_cast<uint8_t>(deviceAddress) & 0x7u];
+
+	device						= Device{};
+	device.present				= true;
+	device.panel				= panel;
+	device.irradiance			= 1.0f;
+	device.efficiency			= efficiency;
+	device.point				= {0.8f * panel.vOc, 0.0f, vOut, 0.0f, false};
+	device.mpptStep				= panel.vOc / 200.0f;
+	device.lastPower			= 0.0f;
+	device.increasing			= true;
+	device.thresholdPassThrough	= false;
+
+	device.reg0 = Register(Reg0(Register(0x0u)));
+	device.reg3 = Register(Reg3());
+	device.reg4 = Register(Reg4(Register(0x0u)));
+	device.reg5 = Register(Reg5());
+
+	step(device);
+}
+
+void SimulatedSM72445::removeDevice(DeviceAddress deviceAddress) {
+	this->devices[static_cast<uint8_t>(deviceAddress) & 0x7u].present = false;
+}
+
+void SimulatedSM72445::setIrradiance(DeviceAddress deviceAddress, float irradiance) {
+	if (Device *device = getDevice(deviceAddress)) {
+		device->irradiance = irradiance < 0.0f ? 0.0f : irradiance;
+	}
+}
+
+void SimulatedSM72445::setOutputVoltage(DeviceAddress deviceAddress, float vOut) {
+	if (Device *device = getDevice(deviceAddress)) {
+		device->point.vOut = vOut < 0.0f ? 0.0f : vOut;
+	}
+}
+
+void SimulatedSM72445::setAnalogueChannels(
+	DeviceAddress deviceAddress, //
+	const Reg0	 &reg0
+) {
+	if (Device *device = getDevice(deviceAddress)) device->reg0 = Register(reg0);
+}
+
+void SimulatedSM72445::step(uint32_t iterations) {
+	for (uint32_t i = 0; i < iterations; i++) {
+		for (auto &device : this->devices) {
+			if (device.present) step(device);
+		}
+	}
+}
+
+float SimulatedSM72445::getPanelCurrent(const Device &device, float vIn) const {
+	const Panel &panel	 = device.panel;
+	const float	 current = device.irradiance * panel.iSc
+						* (1.0f - std::exp((vIn - panel.vOc) / panel.vT));
+	return current > 0.0f ? current : 0.0f;
+}
+
+uint16_t SimulatedSM72445::toCounts(float value, float gain) const {
+	const float counts = value * gain / this->gains.vDDA * 0x3FFu;
+
+	if (!(counts > 0.0f)) return 0x0u;
+	if (counts >= 0x3FFu) return 0x3FFu;
+	return static_cast<uint16_t>(counts + 0.5f);
+}
+
+float SimulatedSM72445::fromCounts(uint16_t counts, float gain) const {
+	return counts * this->gains.vDDA / gain / 0x3FFu;
+}
+
+void SimulatedSM72445::operatePassThrough(Device &device) const {
+	OperatingPoint &point = device.point;
+
+	point.vIn		  = point.vOut;
+	point.iIn		  = getPanelCurrent(device, point.vIn);
+	point.iOut		  = point.iIn;
+	point.passThrough = true;
+}
+
+bool SimulatedSM72445::operateMppt(
+	Device	   &device, //
+	const Reg3 &reg3,
+	bool		buckOnly
+) const {
+	OperatingPoint &point = device.point;
+	const Panel	   &panel = device.panel;
+
+	// Perturb and observe.
+	float vIn = point.vIn + (device.increasing ? device.mpptStep : -device.mpptStep);
+
+	const float minimum = buckOnly ? point.vOut : 0.0f;
+	if (vIn < minimum) vIn = minimum;
+	if (vIn > panel.vOc) vIn = panel.vOc;
+
+	const float iIn	  = getPanelCurrent(device, vIn);
+	const float power = vIn * iIn;
+
+	if (power < device.lastPower) device.increasing = !device.increasing;
+	device.lastPower = power;
+
+	float pOut = power * device.efficiency;
+
+	// Curtailment. The converter backs away from the maximum power point towards open
+	// circuit until the output limits are respected.
+	const float iOutMax = fromCounts(reg3.iOutMax, this->gains.iOutGain);
+	const float vOutMax = fromCounts(reg3.vOutMax, this->gains.vOutGain);
+	const float pLimit	= point.vOut > vOutMax ? 0.0f : iOutMax * point.vOut;
+
+	const bool curtailed = pOut > pLimit;
+	if (curtailed) {
+		device.increasing = true;
+		pOut			  = pLimit;
+	}
+
+	point.vIn		  = vIn;
+	point.iIn		  = iIn;
+	point.iOut		  = point.vOut > 0.0f ? pOut / point.vOut : 0.0f;
+	point.passThrough = false;
+
+	return curtailed;
+}
+
+void SimulatedSM72445::step(Device &device) const {
+	OperatingPoint &point = device.point;
+
+	const Reg3 reg3{device.reg3};
+	const Reg5 reg5{device.reg5};
+
+	if (reg3.bbReset) {
+		// Converter held in reset, panel left open circuit.
+		point.vIn					= device.panel.vOc;
+		point.iIn					= 0.0f;
+		point.iOut					= 0.0f;
+		point.passThrough			= false;
+		device.lastPower			= 0.0f;
+		device.thresholdPassThrough = false;
+	} else if (reg3.passThroughSelect && reg3.passThroughManual) {
+		operatePassThrough(device);
+	} else if (device.thresholdPassThrough) {
+		operatePassThrough(device);
+
+		const bool aboveHigh = toCounts(point.iIn, this->gains.iInGain) > reg5.iInHigh
+							&& toCounts(point.iOut, this->gains.iOutGain) > reg5.iOutHigh;
+		if (aboveHigh) device.thresholdPassThrough = false;
+	} else {
+		// Without an override, the A2 configuration is taken from the strapped ADC2
+		// result, whose upper three bits select the row of datasheet Table 1.
+		const uint8_t a2 = reg3.overrideAdcProgramming ? reg3.a2Override
+													   : Reg0(device.reg0).ADC2 >> 7u;
+		const bool	  hBridge = a2 >= 0x3u && a2 <= 0x5u;
+
+		// Deliberate curtailment must not be mistaken for low light.
+		const bool curtailed = operateMppt(device, reg3, !hBridge);
+
+		const bool belowLow = toCounts(point.iIn, this->gains.iInGain) < reg5.iInLow
+						   || toCounts(point.iOut, this->gains.iOutGain) < reg5.iOutLow;
+		if (belowLow && !curtailed) device.thresholdPassThrough = true;
+	}
+
+	device.reg1 = Register(Reg1(
+		toCounts(point.iIn, this->gains.iInGain),
+		toCounts(point.vIn, this->gains.vInGain),
+		toCounts(point.iOut, this->gains.iOutGain),
+		toCounts(point.vOut, this->gains.vOutGain)
+	));
+}
+
+optional<OperatingPoint> SimulatedSM72445::getOperatingPoint(DeviceAddress deviceAddress
+) const {
+	const Device *device = getDevice(deviceAddress);
+
+	if (!device) return nullopt;
+	return device->point;
+}
+
+optional<Register> SimulatedSM72445::read(
+	DeviceAddress deviceAddress, //
+	MemoryAddress memoryAddress
+) {
+	const Device *device = getDevice(deviceAddress);
+
+	if (!device) return nullopt;
+
+	switch (memoryAddress) {
+	case MemoryAddress::REG0:
+		return device->reg0;
+	case MemoryAddress::REG1:
+		return device->reg1;
+	case MemoryAddress::REG3:
+		return device->reg3;
+	case MemoryAddress::REG4:
+		return device->reg4;
+	case MemoryAddress::REG5:
+		return device->reg5;
+	default:
+		return nullopt;
+	}
+}
+
+optional<Register> SimulatedSM72445::write(
+	DeviceAddress deviceAddress,
+	MemoryAddress memoryAddress,
+	Register	  data
+) {
+	Device *device = getDevice(deviceAddress);
+
+	if (!device) return nullopt;
+
+	// Registers hold only their defined bits, as per the structural encodings.
+	switch (memoryAddress) {
+	case MemoryAddress::REG3:
+		device->reg3 = Register(Reg3(data));
+		return data;
+	case MemoryAddress::REG4:
+		device->reg4 = Register(Reg4(data));
+		return data;
+	case MemoryAddress::REG5:
+		device->reg5 = Register(Reg5(data));
+		return data;
+	case MemoryAddress::REG0:
+	case MemoryAddress::REG1:
+	default:
+		return nullopt; // Read only.
+	}
+}
@@ -0,0 +1,329 @@
+/**
+ ******************************************************************************
+ * @file			: SM72445_Telemetry.cpp
+ * @brief			: Source for SM72445_Telemetry.hpp
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "SM72445_Telemetry.hpp"
+
+#include <cerrno>
+#include <chrono>
+#include <ctime>
+#include <new>
+#include <thread>
+
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using Register		= SM72445::Register;
+using DeviceAddress = SM72445::DeviceAddress;
+using MemoryAddress = SM72445::MemoryAddress;
+using Record		= TelemetrySegment::Record;
+
+using std::nullopt;
+
+// Padded to a cache line so that the slots which follow it are correctly aligned.
+struct alignas(64) TelemetrySegment::Header {
+	static constexpr uint32_t MAGIC	  = 0x5337'3234u; // "S724"
+	static constexpr uint32_t VERSION = 2u;
+
+	std::atomic<uint32_t> magic; // Set last, once the layout is fully initialised.
+	uint32_t			  version;
+	uint32_t			  busCount;
+	uint32_t			  slotSize;
+	std::atomic<int32_t>  publisher; // Process ID of the creator. Set first.
+};
+
+static_assert(
+	std::atomic<uint32_t>::is_always_lock_free && std::atomic<int32_t>::is_always_lock_free,
+	"The header is shared between processes and must be lock-free"
+);
+
+// A segment whose creator is unknown is assumed to be mid-creation until this old.
+static constexpr time_t UNKNOWN_CREATOR_GRACE_SECONDS = 10;
+
+// A store takes nanoseconds, so a slot stuck mid-store for this many reads is either held
+// by a descheduled publisher, or was abandoned by one that died. A descheduled publisher
+// resumes well within the timeout.
+static constexpr size_t					   SNAPSHOT_ATTEMPTS = 256u;
+static constexpr std::chrono::milliseconds SNAPSHOT_TIMEOUT{100};
+
+struct alignas(64) TelemetrySegment::Slot { // One cache line per device.
+	SeqLock<Record> record;
+};
+
+size_t TelemetrySegment::getSize(uint8_t busCount) {
+	return sizeof(Header) + sizeof(Slot) * busCount * DEVICES_PER_BUS;
+}
+
+TelemetrySegment::TelemetrySegment(
+	const std::string &name,
+	bool			   owner,
+	Header			  *header,
+	size_t			   size
+)
+	: name{name}, owner{owner}, header{header}, size{size} {}
+
+TelemetrySegment::TelemetrySegment(TelemetrySegment &&other) noexcept
+	: name{std::move(other.name)}, //
+	  owner{other.owner},
+	  header{other.header},
+	  size{other.size} {
+	other.owner	 = false;
+	other.header = nullptr;
+}
+
+TelemetrySegment::~TelemetrySegment() {
+	if (this->header) munmap(this->header, this->size);
+	if (this->owner) shm_unlink(this->name.c_str());
+}
+
+static inline bool isAlive(int32_t pid) {
+	return kill(static_cast<pid_t>(pid), 0) == 0 || errno != ESRCH;
+}
+
+bool TelemetrySegment::isStale(const std::string &name) {
+	const int fd = shm_open(name.c_str(), O_RDONLY, 0);
+	if (fd < 0) return false;
+
+	struct stat status;
+	if (fstat(fd, &status) != 0) {
+		close(fd);
+		return false;
+	}
+
+	int32_t publisher = 0;
+	if (size_t(status.st_size) >= sizeof(Header)) {
+		void *memory = mmap(nullptr, sizeof(Header), PROT_READ, MAP_SHARED, fd, 0);
+		if (memory != MAP_FAILED) {
+			publisher = static_cast<const Header *>(memory)->publisher.load(
+				std::memory_order_acquire
+			);
+			munmap(memory, sizeof(Header));
+		}
+	}
+	close(fd);
+
+	// The magic is not checked: a creator which died mid-initialisation never sets it.
+	if (publisher != 0) return !isAlive(publisher);
+
+	// The creator died, or is still running, between creating the object and recording
+	// itself. Only the latter is brief.
+	return time(nullptr) - status.st_mtime > UNKNOWN_CREATOR_GRACE_SECONDS;
+}
+
+optional<TelemetrySegment> TelemetrySegment::create(
+	const std::string &name, //
+	uint8_t			   busCount
+) {
+	int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0644);
+
+	// Only reclaim a segment left behind by a publisher which has since exited.
+	if (fd < 0 && errno == EEXIST && isStale(name)) {
+		shm_unlink(name.c_str());
+		fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0644);
+	}
+	if (fd < 0) return nullopt;
+
+	const size_t size = getSize(busCount);
+	if (ftruncate(fd, static_cast<off_t>(size)) != 0) {
+		close(fd);
+		shm_unlink(name.c_str());
+		return nullopt;
+	}
+
+	void *memory = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	close(fd);
+	if (memory == MAP_FAILED) {
+		shm_unlink(name.c_str());
+		return nullopt;
+	}
+
+	Header *header = static_cast<Header *>(memory);
+
+	// Record the creator before anything else, so that the segment can be reclaimed if
+	// it dies mid-initialisation.
+	new (&header->publisher) std::atomic<int32_t>{0};
+	header->publisher.store(static_cast<int32_t>(getpid()), std::memory_order_release);
+
+	new (&header->magic) std::atomic<uint32_t>{0u};
+	header->version	 = Header::VERSION;
+	header->busCount = busCount;
+	header->slotSize = sizeof(Slot);
+
+	Slot *slots = reinterpret_cast<Slot *>(header + 1);
+	for (size_t i = 0; i < size_t(busCount) * DEVICES_PER_BUS; i++) {
+		new (&slots[i]) Slot{};
+	}
+
+	header->magic.store(Header::MAGIC, std::memory_order_release);
+
+	return TelemetrySegment(name, true, header, size);
+}
+
+optional<TelemetrySegment> TelemetrySegment::open(const std::string &name) {
+	const int fd = shm_open(name.c_str(), O_RDONLY, 0);
+	if (fd < 0) return nullopt;
+
+	struct stat status;
+	if (fstat(fd, &status) != 0 || size_t(status.st_size) < sizeof(Header)) {
+		close(fd);
+		return nullopt;
+	}
+
+	const size_t size	= status.st_size;
+	void		*memory = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+	close(fd);
+	if (memory == MAP_FAILED) return nullopt;
+
+	Header *header = static_cast<Header *>(memory);
+
+	const bool compatible = header->magic.load(std::memory_order_acquire) == Header::MAGIC
+						 && header->version == Header::VERSION
+						 && header->slotSize == sizeof(Slot)
+						 && size >= getSize(header->busCount);
+	if (!compatible) {
+		munmap(memory, size);
+		return nullopt;
+	}
+
+	return TelemetrySegment(name, false, header, size);
+}
+
+uint8_t TelemetrySegment::getBusCount(void) const {
+	return static_cast<uint8_t>(this->header->busCount);
+}
+
+TelemetrySegment::Slot *TelemetrySegment::getSlot(
+	uint8_t		  bus, //
+	DeviceAddress deviceAddress
+) const {
+	if (bus >= this->header->busCount) return nullptr;
+
+	Slot *slots = reinterpret_cast<Slot *>(this->header + 1);
+	return &slots[bus * DEVICES_PER_BUS + (static_cast<uint8_t>(deviceAddress) & 0x7u)];
+}
+
+void TelemetrySegment::publish(
+	uint8_t		  bus,
+	DeviceAddress deviceAddress,
+	const Record &record
+) {
+	if (!this->owner) return; // Opened segments are mapped read-only.
+
+	if (Slot *slot = getSlot(bus, deviceAddress)) slot->record.store(record);
+}
+
+optional<Record> TelemetrySegment::snapshot(uint8_t bus, DeviceAddress deviceAddress)
+	const {
+	const Slot *slot = getSlot(bus, deviceAddress);
+
+	if (!slot) return nullopt;
+
+	using Clock = std::chrono::steady_clock;
+
+	Record	 record;
+	uint32_t version  = slot->record.getVersion();
+	auto	 deadline = Clock::now() + SNAPSHOT_TIMEOUT;
+
+	while (!slot->record.tryLoad(record, SNAPSHOT_ATTEMPTS)) {
+		if (!isAlive(this->header->publisher.load(std::memory_order_relaxed))) {
+			return nullopt;
+		}
+
+		// Only a publisher making no progress at all times out.
+		if (slot->record.getVersion() != version) {
+			version	 = slot->record.getVersion();
+			deadline = Clock::now() + SNAPSHOT_TIMEOUT;
+		} else if (Clock::now() > deadline) return nullopt;
+
+		std::this_thread::yield();
+	}
+	return record;
+}
+
+TelemetryPublisher::TelemetryPublisher(
+	SM72445::I2C	 &i2c,
+	TelemetrySegment &segment,
+	uint8_t			  bus
+)
+	: i2c{i2c}, segment{segment}, bus{bus}, records{} {}
+
+void TelemetryPublisher::publish(
+	DeviceAddress deviceAddress,
+	MemoryAddress memoryAddress,
+	Register	  data
+) {
+	Record &record = this->records[static_cast<uint8_t>(deviceAddress) & 0x7u];
+
+	if (memoryAddress == MemoryAddress::REG1) {
+		record.reg1	 = data;
+		record.flags |= TelemetrySegment::REG1_VALID;
+	} else if (memoryAddress == MemoryAddress::REG3) {
+		record.reg3	 = data;
+		record.flags |= TelemetrySegment::REG3_VALID;
+	} else return;
+
+	const auto now	 = std::chrono::steady_clock::now().time_since_epoch();
+	record.timestamp = std::chrono::duration_cast<std::chrono::nanoseconds>(now).count();
+
+	this->segment.publish(this->bus, deviceAddress, record);
+}
+
+optional<Register> TelemetryPublisher::read(
+	DeviceAddress deviceAddress, //
+	MemoryAddress memoryAddress
+) {
+	auto data = this->i2c.read(deviceAddress, memoryAddress);
+	if (data) publish(deviceAddress, memoryAddress, *data);
+	return data;
+}
+
+optional<Register> TelemetryPublisher::write(
+	DeviceAddress deviceAddress,
+	MemoryAddress memoryAddress,
+	Register	  data
+) {
+	auto written = this->i2c.write(deviceAddress, memoryAddress, data);
+	if (written) publish(deviceAddress, memoryAddress, *written);
+	return written;
+}
+
+TelemetryReader::TelemetryReader(const TelemetrySegment &segment, uint8_t bus)
+	: segment{segment}, bus{bus} {}
+
+optional<Register> TelemetryReader::read(
+	DeviceAddress deviceAddress, //
+	MemoryAddress memoryAddress
+) {
+	auto record = this->segment.snapshot(this->bus, deviceAddress);
+
+	if (!record) return nullopt;
+
+	switch (memoryAddress) {
+	case MemoryAddress::REG1:
+		if (record->flags & TelemetrySegment::REG1_VALID) return record->reg1;
+		return nullopt;
+	case MemoryAddress::REG3:
+		if (record->flags & TelemetrySegment::REG3_VALID) return record->reg3;
+		return nullopt;
+	default:
+		return nullopt; // Not published.
+	}
+}
+
+optional<Register> TelemetryReader::write(
+	DeviceAddress deviceAddress,
+	MemoryAddress memoryAddress,
+	Register	  data
+) {
+	(void)deviceAddress;
+	(void)memoryAddress;
+	(void)data;
+	return nullopt; // Readers never own the bus.
+}
@@ -0,0 +1,286 @@
+/**
+ ******************************************************************************
+ * @file			: SM72445_TraceRecorder.cpp
+ * @brief			: Source for SM72445_TraceRecorder.hpp
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "SM72445_TraceRecorder.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <thread>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+using Phase = TraceRecorder::Phase;
+using Event = TraceRecorder::Event;
+
+std::atomic<TraceRecorder *> TraceRecorder::active{nullptr};
+
+#ifdef SM72445_TRACE
+/**
+ * @brief A thread's count of its hook calls, odd while one is in progress. Written only by
+ * the thread which holds it, so hook calls on different threads never contend.
+ *
+ * @details Slots form a list which uninstall() scans, and are recycled when their thread
+ * exits. They are never freed, so the list grows only to the peak number of threads to
+ * have called the hook at once.
+ */
+struct alignas(64) HookSlot {
+	std::atomic<uint64_t> calls{0u};
+	std::atomic<bool>	  claimed{true};
+	HookSlot			 *next{nullptr};
+};
+
+static std::atomic<HookSlot *> hookSlots{nullptr};
+
+/**
+ * @brief Holds the calling thread's hook slot, releasing it for reuse on thread exit.
+ */
+struct HookSlotLease {
+	HookSlot *slot{nullptr};
+
+	~HookSlotLease() {
+		if (this->slot) this->slot->claimed.store(false, std::memory_order_release);
+	}
+};
+
+static thread_local HookSlotLease hookSlotLease{};
+
+static HookSlot &getHookSlot(void) {
+	if (hookSlotLease.slot) return *hookSlotLease.slot;
+
+	for (HookSlot *slot = hookSlots.load(); slot; slot = slot->next) {
+		bool expected = false;
+		if (slot->claimed.compare_exchange_strong(expected, true)) {
+			return *(hookSlotLease.slot = slot);
+		}
+	}
+
+	HookSlot *slot = new HookSlot{};
+	slot->next	   = hookSlots.load();
+	while (!hookSlots.compare_exchange_weak(slot->next, slot)) {}
+	return *(hookSlotLease.slot = slot);
+}
+#endif
+
+static std::atomic<uint64_t> nextRecorderId{1u};
+
+/**
+ * @brief The calling thread's buffers in the recorders it most recently recorded into.
+ */
+struct ThreadCache {
+	static constexpr size_t ENTRIES = 4u;
+
+	struct Entry {
+		uint64_t recorderId;
+		void	*buffer;
+	};
+
+	Entry  entries[ENTRIES];
+	size_t next; // Round-robin replacement.
+};
+
+static thread_local ThreadCache threadCache{};
+
+uint64_t TraceRecorder::getNanoseconds(void) {
+	const auto now = std::chrono::steady_clock::now().time_since_epoch();
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(now).count();
+}
+
+uint64_t TraceRecorder::getTicks(void) {
+	// The invariant TSC (or generic timer) is read without a system call, and converted to
+	// nanoseconds only on export.
+#if defined(__x86_64__) || defined(__i386__)
+	return __rdtsc();
+#elif defined(__aarch64__)
+	uint64_t ticks;
+	asm volatile("mrs %0, cntvct_el0" : "=r"(ticks));
+	return ticks;
+#else
+	return getNanoseconds();
+#endif
+}
+
+TraceRecorder::TraceRecorder(size_t capacity)
+	: id{nextRecorderId.fetch_add(1u)},
+	  capacity{capacity},
+	  originTicks{getTicks()},
+	  originNanoseconds{getNanoseconds()},
+	  mutex{},
+	  buffers{} {}
+
+TraceRecorder::~TraceRecorder() { uninstall(); }
+
+void TraceRecorder::install(void) {
+	active.store(this); // Ordered with the hook's load, which uninstall() relies on.
+#ifdef SM72445_TRACE
+	SM72445_Trace::hook.store(hook, std::memory_order_release);
+#endif
+}
+
+void TraceRecorder::uninstall(void) {
+	TraceRecorder *expected = this;
+	if (active.compare_exchange_strong(expected, nullptr)) {
+#ifdef SM72445_TRACE
+		SM72445_Trace::hook.store(nullptr, std::memory_order_release);
+#endif
+	}
+
+#ifdef SM72445_TRACE
+	// Wait for hook calls which may still hold this recorder, even if another recorder has
+	// since been installed in its place. Calls starting after active was cleared cannot
+	// see it, so each slot need only be waited on until its current call ends.
+	for (HookSlot *slot = hookSlots.load(); slot; slot = slot->next) {
+		const uint64_t calls = slot->calls.load();
+		if (calls & 0x1u) {
+			while (slot->calls.load() == calls) std::this_thread::yield();
+		}
+	}
+#endif
+}
+
+#ifdef SM72445_TRACE
+void TraceRecorder::hook(const char *name, SM72445_Trace::Phase phase) {
+	HookSlot	  &slot	 = getHookSlot();
+	const uint64_t calls = slot.calls.load(std::memory_order_relaxed);
+
+	slot.calls.store(calls + 1u); // Sequentially consistent with the load of active.
+
+	if (TraceRecorder *recorder = active.load()) {
+		const bool begin = phase == SM72445_Trace::Phase::BEGIN;
+		recorder->record(name, begin ? Phase::BEGIN : Phase::END);
+	}
+
+	slot.calls.store(calls + 2u, std::memory_order_release);
+}
+#endif
+
+TraceRecorder::Buffer &TraceRecorder::getBuffer(void) {
+	for (const auto &entry : threadCache.entries) {
+		if (entry.recorderId == this->id) return *static_cast<Buffer *>(entry.buffer);
+	}
+
+	std::lock_guard<std::mutex> lock(this->mutex);
+
+	// The thread may have been evicted from the cache; keep its original buffer and tid.
+	const std::thread::id owner	 = std::this_thread::get_id();
+	Buffer				 *buffer = nullptr;
+
+	for (const auto &candidate : this->buffers) {
+		if (candidate->owner == owner) buffer = candidate.get();
+	}
+
+	if (!buffer) {
+		const uint32_t threadId = static_cast<uint32_t>(this->buffers.size());
+		this->buffers.emplace_back(new Buffer{
+			threadId,
+			owner,
+			std::unique_ptr<Event[]>(new Event[this->capacity]()), // Pre-faulted.
+			{0u},
+			{0u},
+		});
+		buffer = this->buffers.back().get();
+	}
+
+	threadCache.entries[threadCache.next] = ThreadCache::Entry{this->id, buffer};
+	threadCache.next = (threadCache.next + 1u) % ThreadCache::ENTRIES;
+	return *buffer;
+}
+
+void TraceRecorder::record(const char *name, Phase phase) {
+	Buffer		&buffer = getBuffer();
+	const size_t size	= buffer.size.load(std::memory_order_relaxed);
+
+	if (size >= this->capacity) {
+		buffer.dropped.fetch_add(1u, std::memory_order_relaxed);
+		return;
+	}
+
+	buffer.events[size] = Event{name, getTicks(), phase};
+	buffer.size.store(size + 1u, std::memory_order_release); // Publish to exporters.
+}
+
+size_t TraceRecorder::getEventCount(void) const {
+	std::lock_guard<std::mutex> lock(this->mutex);
+
+	size_t count = 0u;
+	for (const auto &buffer : this->buffers) {
+		count += buffer->size.load(std::memory_order_acquire);
+	}
+	return count;
+}
+
+uint64_t TraceRecorder::getDroppedCount(void) const {
+	std::lock_guard<std::mutex> lock(this->mutex);
+
+	uint64_t count = 0u;
+	for (const auto &buffer : this->buffers) {
+		count += buffer->dropped.load(std::memory_order_relaxed);
+	}
+	return count;
+}
+
+/**
+ * @brief Write a JSON string literal. Trace names are identifiers, but are escaped
+ * regardless so that the output is always valid JSON.
+ */
+static void writeJsonString(std::ostream &stream, const char *string) {
+	stream << '"';
+	for (const char *c = string; *c; c++) {
+		if (*c == '"' || *c == '\\') stream << '\\' << *c;
+		else if (static_cast<unsigned char>(*c) < 0x20u) {
+			char escaped[8];
+			std::snprintf(escaped, sizeof(escaped), "\\u%04x", *c);
+			stream << escaped;
+		} else stream << *c;
+	}
+	stream << '"';
+}
+
+void TraceRecorder::exportChromeTrace(std::ostream &stream) const {
+	std::lock_guard<std::mutex> lock(this->mutex);
+
+	// Calibrate ticks against the steady clock over the lifetime of the recorder.
+	const uint64_t ticks	   = getTicks() - this->originTicks;
+	const uint64_t nanoseconds = getNanoseconds() - this->originNanoseconds;
+	const double   scale	   = ticks ? double(nanoseconds) / double(ticks) : 1.0;
+
+	stream << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+
+	bool first = true;
+	for (const auto &buffer : this->buffers) {
+		const size_t size = buffer->size.load(std::memory_order_acquire);
+
+		for (size_t i = 0; i < size; i++) {
+			const Event &event = buffer->events[i];
+
+			// Clamp events from cores whose counter lags the recorder's origin.
+			const int64_t  elapsed	= int64_t(event.timestamp - this->originTicks);
+			const uint64_t relative = elapsed > 0 ? uint64_t(double(elapsed) * scale) : 0u;
+
+			// Chrome trace timestamps are in microseconds.
+			char timestamp[32];
+			std::snprintf(
+				timestamp,
+				sizeof(timestamp),
+				"%llu.%03llu",
+				static_cast<unsigned long long>(relative / 1'000u),
+				static_cast<unsigned long long>(relative % 1'000u)
+			);
+
+			stream << (first ? "" : ",") << "{\"name\":";
+			writeJsonString(stream, event.name);
+			stream << ",\"ph\":\"" << (event.phase == Phase::BEGIN ? 'B' : 'E') << '"'
+				   << ",\"ts\":" << timestamp << ",\"pid\":1,\"tid\":" << buffer->threadId
+				   << '}';
+			first = false;
+		}
+	}
+
+	stream << "]}";
+}
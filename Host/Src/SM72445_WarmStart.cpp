@@ -0,0 +1,281 @@
+/**
+ ******************************************************************************
+ * @file			: SM72445_WarmStart.cpp
+ * @brief			: Source for SM72445_WarmStart.hpp
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "SM72445_WarmStart.hpp"
+
+#include <cstring>
+#include <new>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using Register		= SM72445::Register;
+using DeviceAddress = SM72445::DeviceAddress;
+using MemoryAddress = SM72445::MemoryAddress;
+using Calibration	= WarmStartCache::Calibration;
+using Entry			= WarmStartCache::Entry;
+using Status		= WarmStartValidator::Status;
+
+using std::nullopt;
+
+struct WarmStartCache::Header {
+	static constexpr uint32_t MAGIC	  = 0x5337'3257u; // "S72W"
+	static constexpr uint32_t VERSION = 1u;
+
+	uint32_t magic;
+	uint32_t version;
+	uint32_t busCount;
+	uint32_t slotSize;
+};
+
+struct WarmStartCache::Slot {
+	static constexpr uint32_t VALID = 0x1u;
+
+	uint64_t checksum; // Of flags and entry, excluding any padding.
+	uint32_t flags;
+	uint32_t reserved;
+	Entry	 entry;
+};
+
+/**
+ * @brief FNV-1a over a value's bytes.
+ */
+template <typename T>
+static uint64_t hash(uint64_t state, const T &value) {
+	uint8_t bytes[sizeof(T)];
+	std::memcpy(bytes, &value, sizeof(T));
+	for (uint8_t byte : bytes) state = (state ^ byte) * 0x0000'0100'0000'01B3ull;
+	return state;
+}
+
+static uint64_t getChecksum(uint32_t flags, const Entry &entry) {
+	uint64_t state = 0xCBF2'9CE4'8422'2325ull;
+	state		   = hash(state, flags);
+	for (Register reg : {entry.reg0, entry.reg3, entry.reg4, entry.reg5})
+		state = hash(state, reg);
+
+	const Calibration &calibration = entry.calibration;
+	for (float value :
+		 {calibration.vInGain,
+		  calibration.vOutGain,
+		  calibration.iInGain,
+		  calibration.iOutGain,
+		  calibration.vDDA})
+		state = hash(state, value);
+	return state;
+}
+
+SM72445_X Entry::makeDevice(SM72445::I2C &i2c, DeviceAddress deviceAddress) const {
+	return SM72445_X(i2c, deviceAddress, this->calibration);
+}
+
+size_t WarmStartCache::getSize(uint8_t busCount) {
+	return sizeof(Header) + sizeof(Slot) * busCount * DEVICES_PER_BUS;
+}
+
+WarmStartCache::WarmStartCache(Header *header, size_t size)
+	: header{header}, size{size} {}
+
+WarmStartCache::WarmStartCache(WarmStartCache &&other) noexcept
+	: header{other.header}, //
+	  size{other.size} {
+	other.header = nullptr;
+}
+
+WarmStartCache::~WarmStartCache() {
+	if (this->header) munmap(this->header, this->size);
+}
+
+optional<WarmStartCache> WarmStartCache::open(const std::string &path, uint8_t busCount) {
+	const int fd = ::open(path.c_str(), O_CREAT | O_RDWR, 0644);
+	if (fd < 0) return nullopt;
+
+	const size_t size = getSize(busCount);
+
+	struct stat status;
+	if (fstat(fd, &status) != 0) {
+		close(fd);
+		return nullopt;
+	}
+
+	void *memory = MAP_FAILED;
+	if (size_t(status.st_size) == size) {
+		memory = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	}
+
+	Header *header = static_cast<Header *>(memory);
+
+	const bool compatible = memory != MAP_FAILED
+						 && header->magic == Header::MAGIC
+						 && header->version == Header::VERSION
+						 && header->busCount == busCount
+						 && header->slotSize == sizeof(Slot);
+	if (!compatible) {
+		if (memory != MAP_FAILED) munmap(memory, size);
+
+		// Truncating to zero first zero-fills every slot, marking it invalid.
+		const bool resized = ftruncate(fd, 0) == 0
+						  && ftruncate(fd, static_cast<off_t>(size)) == 0;
+		memory = resized ? mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0)
+						 : MAP_FAILED;
+		if (memory == MAP_FAILED) {
+			close(fd);
+			return nullopt;
+		}
+
+		header = new (memory) Header{0u, Header::VERSION, busCount, sizeof(Slot)};
+		header->magic = Header::MAGIC; // Written last, once the header is complete.
+	}
+	close(fd);
+
+	return WarmStartCache(header, size);
+}
+
+uint8_t WarmStartCache::getBusCount(void) const {
+	return static_cast<uint8_t>(this->header->busCount);
+}
+
+WarmStartCache::Slot *WarmStartCache::getSlot(uint8_t bus, DeviceAddress deviceAddress)
+	const {
+	if (bus >= this->header->busCount) return nullptr;
+
+	Slot *slots = reinterpret_cast<Slot *>(this->header + 1);
+	return &slots[bus * DEVICES_PER_BUS + (static_cast<uint8_t>(deviceAddress) & 0x7u)];
+}
+
+optional<Entry> WarmStartCache::lookup(uint8_t bus, DeviceAddress deviceAddress) const {
+	const Slot *slot = getSlot(bus, deviceAddress);
+
+	if (!slot || !(slot->flags & Slot::VALID)) return nullopt;
+	if (slot->checksum != getChecksum(slot->flags, slot->entry)) return nullopt;
+	return slot->entry;
+}
+
+void WarmStartCache::store(uint8_t bus, DeviceAddress deviceAddress, const Entry &entry) {
+	Slot *slot = getSlot(bus, deviceAddress);
+
+	if (!slot) return;
+
+	slot->flags	   = Slot::VALID;
+	slot->entry	   = entry;
+	slot->checksum = getChecksum(slot->flags, slot->entry);
+}
+
+bool WarmStartCache::store(
+	const DeviceDiscovery::Device &device,
+	const Calibration			  &calibration
+) {
+	if (!device.isComplete() || device.bus > UINT8_MAX) return false;
+
+	const Entry entry{device.reg0, *device.reg3, *device.reg4, *device.reg5, calibration};
+	store(static_cast<uint8_t>(device.bus), device.deviceAddress, entry);
+	return true;
+}
+
+void WarmStartCache::invalidate(uint8_t bus, DeviceAddress deviceAddress) {
+	if (Slot *slot = getSlot(bus, deviceAddress)) slot->flags = 0u;
+}
+
+bool WarmStartCache::sync(void) { return msync(this->header, this->size, MS_SYNC) == 0; }
+
+/*
+ * The validator's cursor walks addresses ADDR001-ADDR111 and, within each, REGISTERS.
+ */
+static constexpr size_t POSITIONS =
+	WarmStartCache::DEVICES_PER_BUS * WarmStartValidator::REGISTERS.size();
+
+static DeviceAddress getDeviceAddress(size_t position) {
+	return static_cast<DeviceAddress>(position / WarmStartValidator::REGISTERS.size());
+}
+
+static Register &getImage(Entry &entry, size_t position) {
+	switch (position % WarmStartValidator::REGISTERS.size()) {
+	case 0u:
+		return entry.reg0;
+	case 1u:
+		return entry.reg3;
+	case 2u:
+		return entry.reg4;
+	default:
+		return entry.reg5;
+	}
+}
+
+/**
+ * @brief Find the first position at or after a position with a cached entry.
+ */
+static size_t findNext(const WarmStartCache &cache, uint8_t bus, size_t position) {
+	for (; position < POSITIONS; position++) {
+		const DeviceAddress deviceAddress = getDeviceAddress(position);
+		if (static_cast<uint8_t>(deviceAddress) == 0u) continue; // ADDR000 not supported.
+		if (cache.lookup(bus, deviceAddress)) return position;
+	}
+	return POSITIONS;
+}
+
+WarmStartValidator::WarmStartValidator(
+	WarmStartCache &cache, //
+	SM72445::I2C   &i2c,
+	uint8_t			bus
+)
+	: cache{cache}, //
+	  i2c{i2c},		//
+	  bus{bus},		//
+	  cursor{0u},	//
+	  attempts{0u}, //
+	  changed{0u},	//
+	  failed{0u},	//
+	  evicted{0u} {}
+
+Status WarmStartValidator::validateNext(void) {
+	const size_t position = findNext(this->cache, this->bus, this->cursor);
+	if (position >= POSITIONS) {
+		this->cursor = POSITIONS;
+		return Status::COMPLETE;
+	}
+	if (position != this->cursor) this->attempts = 0u;
+	this->cursor = position; // Advanced only once the register is read, or evicted.
+
+	const DeviceAddress deviceAddress = getDeviceAddress(position);
+	const MemoryAddress memoryAddress = REGISTERS[position % REGISTERS.size()];
+
+	const auto reg = this->i2c.read(deviceAddress, memoryAddress);
+	if (!reg) {
+		this->failed++;
+		if (++this->attempts < MAX_ATTEMPTS) return Status::FAILED;
+
+		// The device's remaining registers are skipped along with its entry.
+		this->cache.invalidate(this->bus, deviceAddress);
+		this->evicted++;
+		this->attempts = 0u;
+		this->cursor   = position + 1u;
+		return Status::EVICTED;
+	}
+	this->attempts = 0u;
+	this->cursor   = position + 1u;
+
+	Entry entry = *this->cache.lookup(this->bus, deviceAddress);
+	if (getImage(entry, position) == *reg) return Status::MATCHED;
+
+	getImage(entry, position) = *reg;
+	this->cache.store(this->bus, deviceAddress, entry);
+	this->changed++;
+	return Status::CHANGED;
+}
+
+bool WarmStartValidator::isComplete(void) const {
+	return findNext(this->cache, this->bus, this->cursor) >= POSITIONS;
+}
+
+uint32_t WarmStartValidator::getChangedCount(void) const { return this->changed; }
+
+uint32_t WarmStartValidator::getFailedCount(void) const { return this->failed; }
+
+uint32_t WarmStartValidator::getEvictedCount(void) const { return this->evicted; }
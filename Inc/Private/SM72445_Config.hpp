@@ -9,10 +9,11 @@
 
 #pragma once
 
+/**
+ * @brief Decoded REG3 configuration in physical units. A plain value, independent of
+ * the device it was read from once constructed.
+ */
 class SM72445_X::Config {
-private:
-	const SM72445 &sm72445;
-
 public:
 	enum class FrequencyMode : uint8_t {
 		LOW	 = 110, // kHz
@@ -58,7 +59,7 @@ public:
 
 private:
 	friend class SM72445_X;
-	explicit Config(const SM72445_X &sm72445, const Reg3 &reg3);
+	explicit Config(const Calibration &calibration, const Reg3 &reg3);
 };
 
 // TODO: Restore constexpr specifiers.
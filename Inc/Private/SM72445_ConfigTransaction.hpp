@@ -0,0 +1,82 @@
+/**
+ ******************************************************************************
+ * @file			: SM72445_ConfigTransaction.hpp
+ * @brief			: Read-modify-write configuration transaction for SM72445.
+ * @note 			: This file is included as part of SM72445_X.hpp.
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#pragma once
+
+/**
+ * @brief A configuration change costing at most one REG3 read and one REG3 write.
+ *
+ * @details
+ * The transaction starts from the REG3 image, either read once when the transaction
+ * begins or supplied by the caller when already known (e.g. from a previous
+ * transaction). Edits are made through edit(), and commit() writes the register only
+ * if the edits changed the image.
+ *
+ * Verification by readback is a separate step so that the caller may defer it, e.g.
+ * to behind its next scheduled bus operation, rather than blocking on it at commit.
+ */
+class SM72445_X::ConfigTransaction {
+public:
+	enum class Status : uint8_t {
+		PENDING,   // Not yet committed.
+		UNCHANGED, // Committed without a write, as the edits did not change the image.
+		WRITTEN,   // Committed by a single write, not yet verified.
+		VERIFIED,  // Written and confirmed by readback.
+		MISMATCH,  // Written, but the readback differs from the written image.
+		FAILED,	   // A read or write failed. Nothing further is attempted.
+	};
+
+private:
+	const SM72445_X &sm72445;
+	optional<Reg3>	 image; // The image on the device, as far as is known.
+	ConfigBuilder	 builder;
+	Status			 status;
+
+public:
+	/**
+	 * @brief Get the builder with which to edit the configuration.
+	 *
+	 * @return The transaction's ConfigBuilder, initialised to the starting image.
+	 * @note Edits made after commit() are not written.
+	 */
+	ConfigBuilder &edit(void);
+
+	/**
+	 * @brief Write the edited configuration, if it differs from the starting image.
+	 *
+	 * @return UNCHANGED or WRITTEN on success, otherwise FAILED. Calling commit() again
+	 * returns the current status without further bus operations.
+	 */
+	Status commit(void);
+
+	/**
+	 * @brief Verify a written configuration by reading REG3 back.
+	 *
+	 * @return VERIFIED, MISMATCH or FAILED if the configuration was WRITTEN. Otherwise,
+	 * the current status without any bus operation.
+	 */
+	Status verify(void);
+
+	/**
+	 * @brief Get the status of this transaction.
+	 */
+	Status getStatus(void) const;
+
+	/**
+	 * @brief Get the REG3 image on the device as far as this transaction knows it. After
+	 * a successful commit, this may begin the next transaction without a read.
+	 *
+	 * @return The image, unless the starting read or a write failed.
+	 */
+	optional<Reg3> getImage(void) const;
+
+private:
+	friend class SM72445_X;
+	explicit ConfigTransaction(const SM72445_X &sm72445, optional<Reg3> image);
+};
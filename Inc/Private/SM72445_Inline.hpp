@@ -0,0 +1,56 @@
+/**
+ ******************************************************************************
+ * @file			: SM72445_Inline.hpp
+ * @brief			: Inline definitions of the SM72445 register accessors.
+ * @note			: This file is included as part of SM72445.hpp.
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#pragma once
+
+/*
+ * Register accessors sit on every polling path. They are defined here rather than in
+ * SM72445.cpp so that each call reduces to the I2C read and field extraction at the call
+ * site, without depending on link-time optimisation.
+ */
+
+template <typename Reg>
+inline optional<Reg> SM72445::getRegister(SM72445::MemoryAddress memoryAddress) const {
+	SM72445_TRACE_SCOPE("SM72445::getRegister");
+
+	optional<Register> transmission;
+	{
+		SM72445_TRACE_SCOPE("SM72445::I2C::read");
+		transmission = this->i2c.read(this->deviceAddress, memoryAddress);
+	}
+
+	if (!transmission) return std::nullopt;
+
+	Reg reg{*transmission};
+	return reg;
+}
+
+inline optional<SM72445::Reg0> SM72445::getAnalogueChannelRegister(void) const {
+	return getRegister<Reg0>(MemoryAddress::REG0);
+}
+
+inline optional<SM72445::Reg1> SM72445::getElectricalMeasurementsRegister(void) const {
+	return getRegister<Reg1>(MemoryAddress::REG1);
+}
+
+inline optional<SM72445::Reg3> SM72445::getConfigRegister(void) const {
+	return getRegister<Reg3>(MemoryAddress::REG3);
+}
+
+inline optional<SM72445::Reg4> SM72445::getOffsetRegister(void) const {
+	return getRegister<Reg4>(MemoryAddress::REG4);
+}
+
+inline optional<SM72445::Reg5> SM72445::getThresholdRegister(void) const {
+	return getRegister<Reg5>(MemoryAddress::REG5);
+}
+
+inline SM72445::DeviceAddress SM72445::getDeviceAddress(void) const {
+	return this->deviceAddress;
+}
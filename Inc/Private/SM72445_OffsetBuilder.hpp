@@ -0,0 +1,63 @@
+/**
+ ******************************************************************************
+ * @file			: SM72445_OffsetBuilder.hpp
+ * @brief			: Offset register builder object for SM72445.
+ * @note 			: This file is included as part of SM72445_X.hpp.
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#pragma once
+
+/**
+ * @brief Builds and commits REG4 offsets from physical units.
+ *
+ * @details
+ * The counts per Amp or Volt of each offset are computed once on construction, so each
+ * setter costs a single multiplication. Fields are tracked as dirty once set to a value
+ * which differs from the register image, and commit() writes REG4 only if any field is
+ * dirty.
+ */
+class SM72445_X::OffsetBuilder {
+	static constexpr uint8_t RESOLUTION = 8u; // Offsets are 8-bit ADC counts.
+
+	const SM72445_X &sm72445;
+	Reg4			 reg4;
+	array<float, 4>	 countsPerUnit; // Indexed by ElectricalProperty.
+	uint8_t			 dirty;			// Bitmask of ElectricalProperty fields.
+
+public:
+	/**
+	 * @brief Set an Offset.
+	 *
+	 * @param property The electrical property whose offset to set.
+	 * @param offset The offset to set, in Amps or Volts.
+	 * @return This OffsetBuilder.
+	 * @note An offset outside the settable range sets the field to zero.
+	 */
+	OffsetBuilder &setOffset(ElectricalProperty property, float offset);
+
+	/**
+	 * @brief Check whether any field has been set since construction or the last
+	 * successful commit.
+	 */
+	bool isDirty(void) const;
+
+	/**
+	 * @brief "Build" the Offset Register.
+	 *
+	 * @return The binary value to write to the SM72445's offset register.
+	 */
+	Register build(void) const;
+
+	/**
+	 * @brief Write the Offset Register to the SM72445, if any field is dirty.
+	 *
+	 * @return The value of Reg4, if written successfully or not dirty.
+	 */
+	optional<Register> commit(void);
+
+private:
+	friend class SM72445_X;
+	explicit OffsetBuilder(const SM72445_X &sm72445, SM72445::Reg4 reg4 = Reg4());
+};
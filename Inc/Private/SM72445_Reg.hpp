@@ -9,11 +9,17 @@
 
 #pragma once
 
+/*
+ * Register objects are plain, trivially copyable values occupying exactly one Register
+ * word, so that they may be assigned, stored in arrays and copied with memcpy. Fields are
+ * declared least significant first, following the datasheet bit layout.
+ */
+
 struct SM72445::Reg0 {
-	uint16_t ADC6 : 10;
-	uint16_t ADC4 : 10;
-	uint16_t ADC2 : 10;
-	uint16_t ADC0 : 10;
+	Register ADC0 : 10;
+	Register ADC2 : 10;
+	Register ADC4 : 10;
+	Register ADC6 : 10;
 
 	explicit Reg0() = default;
 	explicit Reg0(Register reg);
@@ -24,10 +30,10 @@ struct SM72445::Reg0 {
 };
 
 struct SM72445::Reg1 {
-	const uint16_t vOut : 10;
-	const uint16_t iOut : 10;
-	const uint16_t vIn	: 10;
-	const uint16_t iIn	: 10;
+	Register iIn  : 10;
+	Register vIn  : 10;
+	Register iOut : 10;
+	Register vOut : 10;
 
 	explicit Reg1() = default;
 	explicit Reg1(Register reg);
@@ -40,24 +46,24 @@ struct SM72445::Reg1 {
 struct SM72445::Reg3 {
 
 public:
-	bool overrideAdcProgramming : 1; // {1'b0}
+	Register openLoopOperation : 1; // {1'b0} Enable Open Loop Operation. Note complex
+									// enable sequence required.
+	Register clkOeManual	   : 1; // {1'b0} Enable PPL Clock on SM72445 Pin 5
+	Register bbReset		   : 1; // {1'b0} Soft Reset
+	Register passThroughManual : 1; // {1'b0} Panel Mode Override Control
+	Register passThroughSelect : 1; // {1'b0} Override enable I2C control of Panel Mode
 private:
-	// Register rsvd3 : 2; // {2'd1} Reserved bits.
+	Register dcOpen : 9; // {9'0FF} Open loop duty cycle. TESTING ONLY.
 public:
-	uint8_t	 a2Override : 3;  // {3'd0} Override enable for ADC2.
-	uint16_t iOutMax	: 10; // {10'd1023} Override maximum output current.
-	uint16_t vOutMax	: 10; // {10'1023} Override maximum output voltage.
-	uint8_t	 tdOff		: 3;  // {3'h3} Dead time off.
-	uint8_t	 tdOn		: 3;  // {3'h3} Dead time on.
+	Register tdOn		: 3;  // {3'h3} Dead time on.
+	Register tdOff		: 3;  // {3'h3} Dead time off.
+	Register vOutMax	: 10; // {10'1023} Override maximum output voltage.
+	Register iOutMax	: 10; // {10'd1023} Override maximum output current.
+	Register a2Override : 3;  // {3'd0} Override enable for ADC2.
 private:
-	uint16_t dcOpen : 9; // {9'0FF} Open loop duty cycle. TESTING ONLY.
+	Register : 3; // Reserved bits.
 public:
-	bool passThroughSelect : 1; // {1'b0} Override enable I2C control of Panel Mode
-	bool passThroughManual : 1; // {1'b0} Panel Mode Override Control
-	bool bbReset		   : 1; // {1'b0} Soft Reset
-	bool clkOeManual	   : 1; // {1'b0} Enable PPL Clock on SM72445 Pin 5
-	bool openLoopOperation : 1; // {1'b0} Enable Open Loop Operation. Note complex enable
-								// sequence required.
+	Register overrideAdcProgramming : 1; // {1'b0}
 
 	explicit Reg3();
 	explicit Reg3(Register reg);
@@ -72,10 +78,10 @@ public:
 };
 
 struct SM72445::Reg4 {
-	uint8_t vOutOffset;
-	uint8_t iOutOffset;
-	uint8_t vInOffset;
-	uint8_t iInOffset;
+	Register iInOffset	: 8;
+	Register vInOffset	: 8;
+	Register iOutOffset : 8;
+	Register vOutOffset : 8;
 
 	explicit Reg4() = default;
 	explicit Reg4(Register reg);
@@ -86,10 +92,10 @@ struct SM72445::Reg4 {
 };
 
 struct SM72445::Reg5 {
-	uint16_t iInHigh  : 10;
-	uint16_t iInLow	  : 10;
-	uint16_t iOutHigh : 10;
-	uint16_t iOutLow  : 10;
+	Register iOutLow  : 10;
+	Register iOutHigh : 10;
+	Register iInLow	  : 10;
+	Register iInHigh  : 10;
 
 	explicit Reg5();
 	explicit Reg5(Register reg);
@@ -97,4 +103,204 @@ struct SM72445::Reg5 {
 
 	explicit operator Register() const;
 	uint16_t operator[](CurrentThreshold threshold) const;
-};
\ No newline at end of file
+};
+
+/* Codecs -----------------------------------------------------------------------------*/
+
+// Defined inline so that callers can reduce register decoding to field extraction.
+
+inline SM72445::Reg0::Reg0(Register reg)
+	: ADC0(static_cast<uint16_t>((reg >> 00u) & 0x3FFu)), //
+	  ADC2(static_cast<uint16_t>((reg >> 10u) & 0x3FFu)), //
+	  ADC4(static_cast<uint16_t>((reg >> 20u) & 0x3FFu)), //
+	  ADC6(static_cast<uint16_t>((reg >> 30u) & 0x3FFu)) {}
+
+inline SM72445::Reg0::Reg0(uint16_t ADC0, uint16_t ADC2, uint16_t ADC4, uint16_t ADC6)
+	: ADC0{ADC0}, //
+	  ADC2{ADC2}, //
+	  ADC4{ADC4}, //
+	  ADC6{ADC6} {}
+
+inline SM72445::Reg0::operator Register() const {
+	auto reg = static_cast<Register>(this->ADC0) << 0u	//
+			 | static_cast<Register>(this->ADC2) << 10u //
+			 | static_cast<Register>(this->ADC4) << 20u //
+			 | static_cast<Register>(this->ADC6) << 30u;
+	return reg;
+}
+
+inline uint16_t SM72445::Reg0::operator[](AnalogueChannel channel) const {
+	switch (channel) {
+	case AnalogueChannel::CH0:
+		return this->ADC0;
+	case AnalogueChannel::CH2:
+		return this->ADC2;
+	case AnalogueChannel::CH4:
+		return this->ADC4;
+	case AnalogueChannel::CH6:
+		return this->ADC6;
+	default:
+		return 0;
+	}
+}
+
+inline SM72445::Reg1::Reg1(Register reg)
+	: iIn{static_cast<uint16_t>((reg >> 00u) & 0x3FFu)},  //
+	  vIn{static_cast<uint16_t>((reg >> 10u) & 0x3FFu)},  //
+	  iOut{static_cast<uint16_t>((reg >> 20u) & 0x3FFu)}, //
+	  vOut{static_cast<uint16_t>((reg >> 30u) & 0x3FFu)} {}
+
+inline SM72445::Reg1::Reg1(uint16_t iIn, uint16_t vIn, uint16_t iOut, uint16_t vOut)
+	: iIn{iIn},	  //
+	  vIn{vIn},	  //
+	  iOut{iOut}, //
+	  vOut{vOut} {}
+
+inline SM72445::Reg1::operator Register() const {
+	auto reg = static_cast<Register>(this->iIn) << 0u	//
+			 | static_cast<Register>(this->vIn) << 10u	//
+			 | static_cast<Register>(this->iOut) << 20u //
+			 | static_cast<Register>(this->vOut) << 30u;
+	return reg;
+}
+
+inline uint16_t SM72445::Reg1::operator[](ElectricalProperty property) const {
+	switch (property) {
+	case ElectricalProperty::CURRENT_IN:
+		return this->iIn;
+	case ElectricalProperty::VOLTAGE_IN:
+		return this->vIn;
+	case ElectricalProperty::CURRENT_OUT:
+		return this->iOut;
+	case ElectricalProperty::VOLTAGE_OUT:
+		return this->vOut;
+	default:
+		return 0u;
+	}
+}
+
+inline SM72445::Reg3::Reg3()
+	: openLoopOperation{false},	 //
+	  clkOeManual{false},		 //
+	  bbReset{false},			 //
+	  passThroughManual{false},	 //
+	  passThroughSelect{false},	 //
+	  dcOpen{0x0FFu},			 //
+	  tdOn{0x3u},				 //
+	  tdOff{0x3u},				 //
+	  vOutMax{1023u},			 //
+	  iOutMax{1023u},			 //
+	  a2Override{0x0u},			 //
+	  overrideAdcProgramming{false} {}
+
+inline SM72445::Reg3::Reg3(Register reg)
+	: openLoopOperation{reg & 0x1u},			  //
+	  clkOeManual{(reg >> 1u) & 0x1u},			  //
+	  bbReset{(reg >> 2u) & 0x1u},				  //
+	  passThroughManual{(reg >> 3u) & 0x1u},	  //
+	  passThroughSelect{(reg >> 4u) & 0x1u},	  //
+	  dcOpen{(reg >> 5u) & 0x1FFu},				  //
+	  tdOn{(reg >> 14u) & 0x7u},				  //
+	  tdOff{(reg >> 17u) & 0x7u},				  //
+	  vOutMax{(reg >> 20u) & 0x3FFu},			  //
+	  iOutMax{(reg >> 30u) & 0x3FFu},			  //
+	  a2Override{(reg >> 40u) & 0x7u},			  //
+	  overrideAdcProgramming{(reg >> 46u) & 0x1u} {}
+
+inline SM72445::Reg3::operator Register() const {
+	const Register reg =
+		(static_cast<Register>(this->overrideAdcProgramming & 0x1u) << 46u)
+		| (static_cast<Register>(this->a2Override) << 40u)				//
+		| (static_cast<Register>(this->iOutMax) << 30u)					//
+		| (static_cast<Register>(this->vOutMax) << 20u)					//
+		| (static_cast<Register>(this->tdOff) << 17u)					//
+		| (static_cast<Register>(this->tdOn) << 14u)					//
+		| (static_cast<Register>(this->dcOpen) << 5u)					//
+		| (static_cast<Register>(this->passThroughSelect & 0x1u) << 4u) //
+		| (static_cast<Register>(this->passThroughManual & 0x1u) << 3u) //
+		| (static_cast<Register>(this->bbReset & 0x1u) << 2u)			//
+		| (static_cast<Register>(this->clkOeManual & 0x1u) << 1u)		//
+		| (static_cast<Register>(this->openLoopOperation & 0x1u));
+	return reg;
+}
+
+inline SM72445::Reg4::Reg4(Register reg)
+	: iInOffset{static_cast<uint8_t>((reg >> 0u) & 0xFFu)},	  //
+	  vInOffset{static_cast<uint8_t>((reg >> 8u) & 0xFFu)},	  //
+	  iOutOffset{static_cast<uint8_t>((reg >> 16u) & 0xFFu)}, //
+	  vOutOffset{static_cast<uint8_t>((reg >> 24u) & 0xFFu)} {}
+
+inline SM72445::Reg4::Reg4(
+	uint8_t iInOffset,
+	uint8_t vInOffset,
+	uint8_t iOutOffset,
+	uint8_t vOutOffset
+)
+	: iInOffset{iInOffset},	  //
+	  vInOffset{vInOffset},	  //
+	  iOutOffset{iOutOffset}, //
+	  vOutOffset{vOutOffset} {}
+
+inline SM72445::Reg4::operator Register() const {
+	return static_cast<Register>(static_cast<Register>(this->iInOffset) << 0u)	 //
+		 | static_cast<Register>(static_cast<Register>(this->vInOffset) << 8u)	 //
+		 | static_cast<Register>(static_cast<Register>(this->iOutOffset) << 16u) //
+		 | static_cast<Register>(static_cast<Register>(this->vOutOffset) << 24u);
+}
+
+inline uint8_t SM72445::Reg4::operator[](ElectricalProperty property) const {
+	switch (property) {
+	case ElectricalProperty::CURRENT_IN:
+		return this->iInOffset;
+	case ElectricalProperty::VOLTAGE_IN:
+		return this->vInOffset;
+	case ElectricalProperty::CURRENT_OUT:
+		return this->iOutOffset;
+	case ElectricalProperty::VOLTAGE_OUT:
+		return this->vOutOffset;
+	default:
+		return 0u;
+	}
+}
+
+inline SM72445::Reg5::Reg5() : iOutLow{24}, iOutHigh{40}, iInLow{24}, iInHigh{40} {}
+
+inline SM72445::Reg5::Reg5(
+	uint16_t iOutLow,
+	uint16_t iOutHigh,
+	uint16_t iInLow,
+	uint16_t iInHigh
+)
+	: iOutLow(iOutLow),	  //
+	  iOutHigh(iOutHigh), //
+	  iInLow(iInLow),	  //
+	  iInHigh(iInHigh) {}
+
+inline SM72445::Reg5::Reg5(Register reg)
+	: iOutLow{static_cast<uint16_t>((reg >> 0u) & 0x3FFu)},	  //
+	  iOutHigh{static_cast<uint16_t>((reg >> 10u) & 0x3FFu)}, //
+	  iInLow{static_cast<uint16_t>((reg >> 20u) & 0x3FFu)},	  //
+	  iInHigh{static_cast<uint16_t>((reg >> 30u) & 0x3FFu)} {}
+
+inline SM72445::Reg5::operator Register() const {
+	Register reg = static_cast<Register>(this->iOutLow) << 0u	//
+				 | static_cast<Register>(this->iOutHigh) << 10u //
+				 | static_cast<Register>(this->iInLow) << 20u	//
+				 | static_cast<Register>(this->iInHigh) << 30u;
+	return reg;
+}
+
+inline uint16_t SM72445::Reg5::operator[](CurrentThreshold threshold) const {
+	switch (threshold) {
+	case CurrentThreshold::CURRENT_IN_LOW:
+		return this->iInLow;
+	case CurrentThreshold::CURRENT_IN_HIGH:
+		return this->iInHigh;
+	case CurrentThreshold::CURRENT_OUT_LOW:
+		return this->iOutLow;
+	case CurrentThreshold::CURRENT_OUT_HIGH:
+		return this->iOutHigh;
+	default:
+		return 0u;
+	}
+}
@@ -0,0 +1,63 @@
+/**
+ ******************************************************************************
+ * @file			: SM72445_ThresholdBuilder.hpp
+ * @brief			: Threshold register builder object for SM72445.
+ * @note 			: This file is included as part of SM72445_X.hpp.
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#pragma once
+
+/**
+ * @brief Builds and commits REG5 MPPT current thresholds from physical units.
+ *
+ * @details
+ * The counts per Amp of each threshold are computed once on construction, so each
+ * setter costs a single multiplication. Fields are tracked as dirty once set to a value
+ * which differs from the register image, and commit() writes REG5 only if any field is
+ * dirty.
+ */
+class SM72445_X::ThresholdBuilder {
+	static constexpr uint8_t RESOLUTION = 10u; // Thresholds are 10-bit ADC counts.
+
+	const SM72445_X &sm72445;
+	Reg5			 reg5;
+	array<float, 4>	 countsPerUnit; // Indexed by CurrentThreshold.
+	uint8_t			 dirty;			// Bitmask of CurrentThreshold fields.
+
+public:
+	/**
+	 * @brief Set a Current Threshold.
+	 *
+	 * @param threshold The threshold to set.
+	 * @param current The current to set, in Amps.
+	 * @return This ThresholdBuilder.
+	 * @note A current outside the settable range sets the field to zero.
+	 */
+	ThresholdBuilder &setCurrentThreshold(CurrentThreshold threshold, float current);
+
+	/**
+	 * @brief Check whether any field has been set since construction or the last
+	 * successful commit.
+	 */
+	bool isDirty(void) const;
+
+	/**
+	 * @brief "Build" the Threshold Register.
+	 *
+	 * @return The binary value to write to the SM72445's threshold register.
+	 */
+	Register build(void) const;
+
+	/**
+	 * @brief Write the Threshold Register to the SM72445, if any field is dirty.
+	 *
+	 * @return The value of Reg5, if written successfully or not dirty.
+	 */
+	optional<Register> commit(void);
+
+private:
+	friend class SM72445_X;
+	explicit ThresholdBuilder(const SM72445_X &sm72445, SM72445::Reg5 reg5 = Reg5());
+};
@@ -0,0 +1,97 @@
+/**
+ ******************************************************************************
+ * @file			: SM72445_X_Inline.hpp
+ * @brief			: Inline definitions of the SM72445_X measurement conversions.
+ * @note			: This file is included as part of SM72445_X.hpp.
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#pragma once
+
+/*
+ * The bulk measurement path is defined inline so that a poll inlines down to the REG1
+ * read, four field extractions and four multiply-divides at the call site.
+ */
+
+inline const SM72445_X::Calibration &SM72445_X::getCalibration(void) const {
+	return *this->calibration.load(std::memory_order_acquire);
+}
+
+inline optional<array<float, 4>> SM72445_X::getElectricalMeasurements(void) const {
+	SM72445_TRACE_SCOPE("SM72445_X::getElectricalMeasurements");
+
+	auto regValues = getElectricalMeasurementsRegister();
+
+	if (!regValues) return std::nullopt;
+
+	return convertElectricalMeasurements(*regValues);
+}
+
+inline optional<array<float, 4>> SM72445_X::convertElectricalMeasurements(
+	const Reg1 &reg1
+) const {
+	SM72445_TRACE_SCOPE("SM72445_X::convertElectricalMeasurements");
+
+	const Calibration &calibration = getCalibration(); // One calibration throughout.
+
+	const array properties = {
+		ElectricalProperty::CURRENT_IN,
+		ElectricalProperty::VOLTAGE_IN,
+		ElectricalProperty::CURRENT_OUT,
+		ElectricalProperty::VOLTAGE_OUT,
+	};
+	array<float, 4> measurements;
+
+	for (auto property : properties) {
+		auto adcResult = reg1[property];
+
+		const float gain = calibration.getGain(property);
+		if (gain == 0.0f) return std::nullopt; // Protect against divide by zero error.
+
+		const float measurement =
+			convertAdcResultToPinVoltage(adcResult, 10u, calibration.vDDA) / gain;
+
+		measurements[static_cast<uint8_t>(property)] = measurement;
+	}
+
+	return measurements;
+}
+
+inline float SM72445_X::convertAdcResultToPinVoltage(
+	uint16_t adcResult,
+	uint8_t	 resolution
+) const {
+	return convertAdcResultToPinVoltage(adcResult, resolution, getCalibration().vDDA);
+}
+
+inline float SM72445_X::convertAdcResultToPinVoltage(
+	uint16_t adcResult,
+	uint8_t	 resolution,
+	float	 vDDA
+) {
+	// ! adcResult is not checked for valid range with respect to resolution here.
+	// Ensure proper masking before calling this function.
+	const float maxAdcResult = (1u << resolution) - 1u;
+	float		voltage		 = adcResult / maxAdcResult * vDDA;
+	return voltage;
+}
+
+inline float SM72445_X::getGain(SM72445::ElectricalProperty property) const {
+	return getCalibration().getGain(property);
+}
+
+inline float SM72445_X::Calibration::getGain(SM72445::ElectricalProperty property) const {
+	switch (property) {
+	case ElectricalProperty::CURRENT_IN:
+		return this->iInGain;
+	case ElectricalProperty::VOLTAGE_IN:
+		return this->vInGain;
+	case ElectricalProperty::CURRENT_OUT:
+		return this->iOutGain;
+	case ElectricalProperty::VOLTAGE_OUT:
+		return this->vOutGain;
+	default:
+		return 0.0;
+	}
+}
@@ -12,6 +12,8 @@
 #include <cstdint>
 #include <optional>
 
+#include "SM72445_Trace.hpp"
+
 using std::array;
 using std::optional;
 
@@ -216,3 +218,4 @@ enum class SM72445::I2C::MemoryAddress : uint8_t {
 };
 
 #include "Private/SM72445_Reg.hpp"
+#include "Private/SM72445_Inline.hpp"
@@ -0,0 +1,119 @@
+/**
+ ******************************************************************************
+ * @file			: SM72445_AdaptivePoll.hpp
+ * @brief			: Adaptive REG1 poll-rate controller for the SM72445.
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#pragma once
+
+#include "SM72445.hpp"
+
+/**
+ * @brief Adjusts the REG1 polling interval of a single SM72445 according to how close
+ * its measured currents are to the MPPT current thresholds held in REG5.
+ *
+ * @details
+ * The SM72445 only changes its operating behaviour around the CURRENT_IN_LOW/HIGH and
+ * CURRENT_OUT_LOW/HIGH thresholds. Polling therefore speeds up immediately when a
+ * current approaches a threshold, and backs off gradually (doubling per poll) when far
+ * from all of them.
+ *
+ * All comparisons are made in raw 10-bit ADC counts; no floating point is required.
+ * Time is expressed in caller-defined ticks (e.g. milliseconds).
+ */
+class AdaptivePollController {
+public:
+	typedef uint32_t Tick;
+
+private:
+	const SM72445 &sm72445;
+
+	const Tick	   minInterval;
+	const Tick	   maxInterval;
+	const uint16_t approachBand; // Distance in counts considered "near" a threshold.
+
+	SM72445::Reg5 thresholds;
+
+	Tick interval;
+	Tick lastPoll;
+
+public:
+	/**
+	 * @brief Construct a new Adaptive Poll Controller.
+	 *
+	 * @param sm72445 The device to poll.
+	 * @param minInterval The poll interval used when near a threshold, in ticks.
+	 * @param maxInterval The poll interval used when far from all thresholds, in ticks.
+	 * @param approachBand The distance, in ADC counts, at which a current is deemed to
+	 * be approaching a threshold.
+	 * @note The thresholds default to the SM72445 reset values until loadThresholds()
+	 * or setThresholds() is called.
+	 */
+	AdaptivePollController(
+		const SM72445 &sm72445,
+		Tick		   minInterval,
+		Tick		   maxInterval,
+		uint16_t	   approachBand = 32u
+	);
+
+	/**
+	 * @brief Read REG5 once from the SM72445 and cache the raw thresholds.
+	 *
+	 * @return The thresholds read, if successful. Cached values are kept otherwise.
+	 */
+	optional<SM72445::Reg5> loadThresholds(void);
+
+	/**
+	 * @brief Set the cached thresholds from a known REG5 image.
+	 *
+	 * @param reg5 The threshold register image.
+	 */
+	void setThresholds(const SM72445::Reg5 &reg5);
+
+	/**
+	 * @brief Update the poll interval from a REG1 measurement.
+	 *
+	 * @param reg1 The latest electrical measurements register.
+	 * @return The new poll interval, in ticks.
+	 */
+	Tick update(const SM72445::Reg1 &reg1);
+
+	/**
+	 * @brief Determine if the device is due to be polled.
+	 *
+	 * @param now The current time, in ticks.
+	 * @return true if at least one interval has elapsed since the last poll.
+	 */
+	bool isDue(Tick now) const;
+
+	/**
+	 * @brief Read REG1 from the SM72445 and update the poll interval.
+	 *
+	 * @param now The current time, in ticks.
+	 * @return The measurements register, if successful.
+	 * @note A failed read falls back to the minimum interval so that the device is
+	 * retried promptly.
+	 */
+	optional<SM72445::Reg1> poll(Tick now);
+
+	/**
+	 * @brief Get the current poll interval.
+	 *
+	 * @return The poll interval, in ticks.
+	 */
+	Tick getInterval(void) const;
+
+	/**
+	 * @brief Get the smallest distance, in ADC counts, between a measurement and the
+	 * threshold that applies to it.
+	 *
+	 * @param reg1 The electrical measurements register.
+	 * @return The distance in counts.
+	 */
+	uint16_t getThresholdDistance(const SM72445::Reg1 &reg1) const;
+
+private:
+	Tick getTargetInterval(uint16_t distance) const;
+};
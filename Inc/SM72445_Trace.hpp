@@ -0,0 +1,71 @@
+/**
+ ******************************************************************************
+ * @file			: SM72445_Trace.hpp
+ * @brief			: Compile-time optional trace points for the SM72445 driver.
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#pragma once
+
+/**
+ * @brief Trace points are compiled into the driver only if SM72445_TRACE is defined
+ * (e.g. with the CMake option of the same name). Otherwise SM72445_TRACE_SCOPE expands
+ * to nothing and the driver carries no trace code or data.
+ *
+ * When compiled in, each trace point calls the installed hook on entry and exit of its
+ * scope. The driver does not record events itself; a recorder (e.g. the host library's
+ * TraceRecorder) installs the hook. With no hook installed, a trace point costs a single
+ * relaxed atomic load.
+ */
+#ifdef SM72445_TRACE
+
+#include <atomic>
+#include <cstdint>
+
+class SM72445_Trace {
+public:
+	enum class Phase : uint8_t {
+		BEGIN,
+		END,
+	};
+
+	/**
+	 * @brief Called on entry and exit of each trace scope.
+	 *
+	 * @param name The static name of the trace point.
+	 * @param phase Whether the scope is being entered or exited.
+	 * @note Called from any thread that uses the driver.
+	 */
+	using Hook = void (*)(const char *name, Phase phase);
+
+	static std::atomic<Hook> hook;
+
+	/**
+	 * @brief RAII trace scope. Emits BEGIN on construction and END on destruction.
+	 */
+	class Scope {
+		const char *const name;
+		const Hook		  scopeHook; // Pairs END with the hook that saw BEGIN.
+
+	public:
+		explicit Scope(const char *name)
+			: name{name}, scopeHook{hook.load(std::memory_order_relaxed)} {
+			if (this->scopeHook) this->scopeHook(this->name, Phase::BEGIN);
+		}
+
+		~Scope() {
+			if (this->scopeHook) this->scopeHook(this->name, Phase::END);
+		}
+
+		Scope(const Scope &) = delete;
+	};
+};
+
+#define SM72445_TRACE_SCOPE(name) const SM72445_Trace::Scope sm72445TraceScope(name)
+
+#else
+
+#define SM72445_TRACE_SCOPE(name)
+
+#endif
@@ -0,0 +1,179 @@
+/**
+ ******************************************************************************
+ * @file			: SM72445_Transport.hpp
+ * @brief			: Raw byte transport for the SM72445, framed by the driver.
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#pragma once
+
+#include "SM72445.hpp"
+
+/**
+ * @brief A caller-owned run of bytes, such as a preallocated DMA buffer.
+ */
+struct ByteSpan {
+	uint8_t *data;
+	size_t	 size;
+};
+
+/**
+ * @brief A bus that only moves raw bytes to and from SM72445 registers.
+ *
+ * @details
+ * Each register transfer is one frame of FramedI2C::FRAME_SIZE bytes, exactly as on the
+ * wire: the length byte, then the seven data bytes LSB first. The transport neither
+ * builds nor checks frames; FramedI2C does.
+ *
+ * The batch variants transfer the same register of several devices into or out of
+ * consecutive frames, and report a frame's failure by clearing its length byte. By
+ * default they issue one single transfer per frame; transports able to queue transfers
+ * (e.g. by DMA) override them.
+ */
+class ByteTransport {
+public:
+	using DeviceAddress = SM72445::DeviceAddress;
+	using MemoryAddress = SM72445::MemoryAddress;
+
+	/**
+	 * @brief Read a register's frame, length byte included.
+	 *
+	 * @param frame The buffer to fill, of FramedI2C::FRAME_SIZE bytes.
+	 * @return True if all of the frame was read.
+	 */
+	virtual bool read(
+		DeviceAddress deviceAddress,
+		MemoryAddress memoryAddress,
+		ByteSpan	  frame
+	) = 0;
+
+	/**
+	 * @brief Write a register's frame, length byte included.
+	 *
+	 * @param frame The frame to transmit, of FramedI2C::FRAME_SIZE bytes.
+	 * @return True if all of the frame was written.
+	 */
+	virtual bool write(
+		DeviceAddress deviceAddress,
+		MemoryAddress memoryAddress,
+		ByteSpan	  frame
+	) = 0;
+
+	/**
+	 * @brief Read a register of several devices into consecutive frames.
+	 *
+	 * @param frames The buffer to fill, of count frames. The length byte of each frame
+	 * that could not be read is cleared.
+	 */
+	virtual void readBatch(
+		const DeviceAddress *deviceAddresses,
+		size_t				 count,
+		MemoryAddress		 memoryAddress,
+		ByteSpan			 frames
+	);
+
+	/**
+	 * @brief Write consecutive frames to a register of several devices.
+	 *
+	 * @param frames The frames to transmit, of count frames. The length byte of each
+	 * frame that could not be written is cleared.
+	 */
+	virtual void writeBatch(
+		const DeviceAddress *deviceAddresses,
+		size_t				 count,
+		MemoryAddress		 memoryAddress,
+		ByteSpan			 frames
+	);
+};
+
+/**
+ * @brief An SM72445::I2C over a ByteTransport, doing the SM72445's framing in one place.
+ *
+ * @details
+ * Reads check the length byte before assembling the register; writes insert it. Frames
+ * are converted with a single 64-bit load or store on little-endian targets.
+ *
+ * Single transfers use a frame buffer owned by this object, so it can be placed in
+ * DMA-capable memory along with it. Batch transfers use a buffer from the caller.
+ *
+ * @note Not thread-safe, as the frame buffer is shared between transfers.
+ */
+class FramedI2C : public SM72445::I2C {
+public:
+	static constexpr uint8_t DATA_LENGTH = 7u; // Bytes of register data per frame.
+	static constexpr size_t	 FRAME_SIZE	 = 1u + DATA_LENGTH;
+
+private:
+	ByteTransport &transport;
+
+	alignas(uint64_t) uint8_t frame[FRAME_SIZE];
+
+public:
+	explicit FramedI2C(ByteTransport &transport);
+
+	FramedI2C(const FramedI2C &) = delete;
+
+	virtual optional<Register> read(
+		DeviceAddress deviceAddress, //
+		MemoryAddress memoryAddress
+	) override;
+
+	/**
+	 * @return The value written, i.e. the seven data bytes of data, if successful.
+	 */
+	virtual optional<Register> write(
+		DeviceAddress deviceAddress,
+		MemoryAddress memoryAddress,
+		Register	  data
+	) override;
+
+	/**
+	 * @brief Read a register of several devices in one batch.
+	 *
+	 * @param registers Set to each device's register, or nullopt on failure.
+	 * @param frames A buffer of at least count frames.
+	 * @return The number of registers read, or 0 without any bus operation if the buffer
+	 * is too small.
+	 */
+	size_t readBatch(
+		const DeviceAddress *deviceAddresses,
+		size_t				 count,
+		MemoryAddress		 memoryAddress,
+		optional<Register>	*registers,
+		ByteSpan			 frames
+	);
+
+	/**
+	 * @brief Write a register of several devices in one batch.
+	 *
+	 * @param data The value to write to each device.
+	 * @param written Set to each value written, as for write(), or nullopt on failure.
+	 * @param frames A buffer of at least count frames.
+	 * @return The number of registers written, or 0 without any bus operation if the
+	 * buffer is too small.
+	 */
+	size_t writeBatch(
+		const DeviceAddress *deviceAddresses,
+		size_t				 count,
+		MemoryAddress		 memoryAddress,
+		const Register		*data,
+		optional<Register>	*written,
+		ByteSpan			 frames
+	);
+
+	/**
+	 * @brief Assemble the register carried by a received frame.
+	 *
+	 * @return The register, or nullopt if the frame's size or length byte is wrong.
+	 */
+	static optional<Register> decode(ByteSpan frame);
+
+	/**
+	 * @brief Build the frame carrying a register. Bits above the seven data bytes are
+	 * not transmitted.
+	 *
+	 * @return True if built, i.e. the buffer holds a frame.
+	 */
+	static bool encode(Register data, ByteSpan frame);
+};
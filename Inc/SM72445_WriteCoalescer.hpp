@@ -0,0 +1,95 @@
+/**
+ ******************************************************************************
+ * @file			: SM72445_WriteCoalescer.hpp
+ * @brief			: Latest-wins REG3 write coalescer for the SM72445.
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#pragma once
+
+#include "SM72445_X.hpp"
+
+/**
+ * @brief Merges REG3 images submitted for a single SM72445 and writes at most one per
+ * flush, so that write traffic is bounded by the flush rate rather than by how often a
+ * controller changes its mind.
+ *
+ * @details
+ * Submitted images replace any pending image (latest wins). The caller's scheduler
+ * calls flush() once per bus slot; it writes the pending image only if it differs from
+ * the image last written.
+ *
+ * Optionally, changes to the iOutMax and vOutMax override counts are slew-rate limited
+ * to a maximum step per flush. A pending image whose limits are not yet reached stays
+ * pending, and subsequent flushes continue to ramp towards it. Slewing requires a known
+ * starting image, from load(), setKnownImage() or a previous flush.
+ *
+ * @note Not thread-safe. Submit and flush from the same thread, or serialise externally.
+ */
+class ConfigWriteCoalescer {
+	const SM72445_X &sm72445;
+	const uint16_t	 maxStep; // Maximum change in override counts per flush, or zero.
+
+	optional<SM72445::Reg3> known;	 // The image on the device, as far as is known.
+	optional<SM72445::Reg3> pending; // The latest submitted image, not yet written.
+
+	uint32_t coalesced; // Submissions replaced before being written.
+
+public:
+	/**
+	 * @brief Construct a new Config Write Coalescer.
+	 *
+	 * @param sm72445 The device to write.
+	 * @param maxStep The maximum change in the iOutMax and vOutMax override counts per
+	 * flush, or zero for no slew-rate limiting.
+	 */
+	explicit ConfigWriteCoalescer(const SM72445_X &sm72445, uint16_t maxStep = 0u);
+
+	/**
+	 * @brief Read REG3 once from the SM72445 and use it as the known image.
+	 *
+	 * @return The image read, if successful. The known image is kept otherwise.
+	 */
+	optional<SM72445::Reg3> load(void);
+
+	/**
+	 * @brief Set the known image without any bus operation.
+	 *
+	 * @param reg3 The configuration register image known to be on the SM72445.
+	 */
+	void setKnownImage(const SM72445::Reg3 &reg3);
+
+	/**
+	 * @brief Submit a configuration, replacing any pending configuration.
+	 *
+	 * @param configRegister The configuration, e.g. from a ConfigBuilder.
+	 */
+	void submit(SM72445::ConfigRegister configRegister);
+
+	/**
+	 * @brief Write the pending configuration, or the next slew-limited step towards it.
+	 *
+	 * @return The value written to Reg3, or nullopt if nothing was written. After a
+	 * failed write, the configuration remains pending.
+	 */
+	optional<SM72445::Register> flush(void);
+
+	/**
+	 * @brief Check whether a configuration is waiting to be written.
+	 */
+	bool isPending(void) const;
+
+	/**
+	 * @brief Get the image on the device as far as is known.
+	 */
+	optional<SM72445::Reg3> getKnownImage(void) const;
+
+	/**
+	 * @brief Get the number of submissions replaced before being written.
+	 */
+	uint32_t getCoalescedCount(void) const;
+
+private:
+	SM72445::Reg3 getNextImage(void) const;
+};
@@ -8,6 +8,8 @@
 
 #pragma once
 
+#include <atomic>
+
 #include "SM72445.hpp"
 
 /**
@@ -16,17 +18,39 @@
  *
  */
 class SM72445_X : public SM72445 {
+public:
+	/**
+	 * @brief The calibration of an SM72445_X. Published blocks are never modified, so a
+	 * reader holding a reference sees one consistent calibration.
+	 */
+	struct Calibration {
+		float vInGain;	   // Input Voltage Gain = vInAdc : vInReal
+		float vOutGain;	   // Output Voltage Gain = vOutAdc : vOutReal
+		float iInGain;	   // Input Current Gain = iInAdc : iInReal
+		float iOutGain;	   // Output Current Gain = iOutAdc : iOutReal
+		float vDDA = 5.0f; // Analog Supply Voltage
+
+		float getGain(SM72445::ElectricalProperty property) const;
+		float getGain(SM72445::CurrentThreshold threshold) const;
+
+		bool operator==(const Calibration &other) const;
+	};
+
 private:
-	const float vDDA;
+	const Calibration				 defaultCalibration;
+	std::atomic<const Calibration *> calibration; // Published block, or the default.
 
-	const float vInGain;
-	const float vOutGain;
-	const float iInGain;
-	const float iOutGain;
+	static_assert(
+		std::atomic<const Calibration *>::is_always_lock_free,
+		"Calibration publishing must be lock-free, i.e. a plain load and store"
+	);
 
 public:
 	struct Config;
 	class ConfigBuilder;
+	class ConfigTransaction;
+	class OffsetBuilder;
+	class ThresholdBuilder;
 
 public:
 	SM72445_X(
@@ -39,6 +63,52 @@ public:
 		float		  vDDA = 5.0f // Analog Supply Voltage
 	);
 
+	SM72445_X(I2C &i2c, DeviceAddress deviceAddress, const Calibration &calibration);
+
+	/**
+	 * @brief Construct a device with a published calibration block, as if by
+	 * setCalibration(), so that several devices may share one block from the start.
+	 *
+	 * @param calibration The block to publish, which must not be null. A copy is kept as
+	 * the calibration given at construction.
+	 */
+	SM72445_X(I2C &i2c, DeviceAddress deviceAddress, const Calibration *calibration);
+
+	/**
+	 * @brief Copy a device. The copy owns a copy of the calibration currently in use.
+	 */
+	SM72445_X(const SM72445_X &other);
+
+	/**
+	 * @brief Get the calibration in use.
+	 *
+	 * @return The calibration block. Read it through one reference for a consistent
+	 * calibration across several conversions.
+	 */
+	const Calibration &getCalibration(void) const;
+
+	/**
+	 * @brief Publish a new calibration, without locks and without pausing readers.
+	 *
+	 * @details Conversions already in progress complete with the previous calibration;
+	 * conversions starting afterwards use the new one. Offset and threshold builders copy
+	 * the scale factors they need when created, so keep those of the calibration in use
+	 * at the time, and do not refer to the block.
+	 *
+	 * @param calibration The new calibration block, or nullptr to restore the calibration
+	 * given at construction. The block must not be modified while published.
+	 * @return The previously published block, or nullptr if it was the constructor's.
+	 * @warning A replaced block may still be read by conversions in progress on other
+	 * threads, e.g. through getCalibration(), so it may be freed only after a grace period
+	 * in which every such conversion has completed. The host library's
+	 * CalibrationPublisher provides one. Without a grace period, keep replaced blocks for
+	 * the lifetime of the device. Do not detect a replacement by the block's address:
+	 * once blocks are freed, a new block may be allocated at the address of an old one.
+	 * @note Only one thread may publish to a given device, as publishing is a plain
+	 * load and store rather than an exchange, which some targets (e.g. ARMv6-M) lack.
+	 */
+	const Calibration *setCalibration(const Calibration *calibration);
+
 	/**
 	 * @brief Get the Configuration of the SM72445.
 	 *
@@ -123,6 +193,16 @@ public:
 	 */
 	optional<array<float, 4>> getElectricalMeasurements(void) const;
 
+	/**
+	 * @brief Convert a previously read Electrical Measurements register to real values.
+	 *
+	 * @param reg1 The register values to convert.
+	 * @return The measurements, indexed by ElectricalProperty, if the gains are valid.
+	 * @note Voltage measurements are returned in Volts.
+	 * @note Current measurements are returned in Amps.
+	 */
+	optional<array<float, 4>> convertElectricalMeasurements(const Reg1 &reg1) const;
+
 	/**
 	 * @brief Get the Analogue Configuration Channel Pin Voltages.
 	 *
@@ -157,6 +237,40 @@ public:
 	 */
 	ConfigBuilder getConfigBuilder(bool fetchCurrentConfig = false) const;
 
+	/**
+	 * @brief Begin a Configuration Transaction, reading the current configuration once.
+	 *
+	 * @return A ConfigTransaction object. If the read failed, its status is FAILED.
+	 */
+	ConfigTransaction beginConfigTransaction(void) const;
+
+	/**
+	 * @brief Begin a Configuration Transaction from a known configuration, without any
+	 * bus operation.
+	 *
+	 * @param image The configuration register image known to be on the SM72445.
+	 * @return A ConfigTransaction object.
+	 */
+	ConfigTransaction beginConfigTransaction(Reg3 image) const;
+
+	/**
+	 * @brief Get an Offset Builder Object.
+	 *
+	 * @param fetchCurrentOffsets If true, the current offsets will be fetched from the
+	 * SM72445 and used to initialise the state of the OffsetBuilder.
+	 * @return An OffsetBuilder object.
+	 */
+	OffsetBuilder getOffsetBuilder(bool fetchCurrentOffsets = false) const;
+
+	/**
+	 * @brief Get a Threshold Builder Object.
+	 *
+	 * @param fetchCurrentThresholds If true, the current thresholds will be fetched from
+	 * the SM72445 and used to initialise the state of the ThresholdBuilder.
+	 * @return A ThresholdBuilder object.
+	 */
+	ThresholdBuilder getThresholdBuilder(bool fetchCurrentThresholds = false) const;
+
 	/**
 	 * @brief Convert an SM72445 binary ADC result to the pin voltage, given the assumed
 	 * supply voltage reference vDDA.
@@ -168,6 +282,12 @@ public:
 	float convertAdcResultToPinVoltage(uint16_t adcResult, uint8_t resolution) const;
 
 private:
+	static float convertAdcResultToPinVoltage(
+		uint16_t adcResult,
+		uint8_t	 resolution,
+		float	 vDDA
+	);
+
 	float			getGain(SM72445::ElectricalProperty property) const;
 	float			getGain(SM72445::CurrentThreshold threshold) const;
 	constexpr float getGain(SM72445::AnalogueChannel threshold) const {
@@ -188,3 +308,7 @@ private:
 
 #include "Private/SM72445_Config.hpp"
 #include "Private/SM72445_ConfigBuilder.hpp"
+#include "Private/SM72445_ConfigTransaction.hpp"
+#include "Private/SM72445_OffsetBuilder.hpp"
+#include "Private/SM72445_ThresholdBuilder.hpp"
+#include "Private/SM72445_X_Inline.hpp"
@@ -0,0 +1,118 @@
+/**
+ ******************************************************************************
+ * @file			: SM72445_AdaptivePoll.cpp
+ * @brief			: Source for SM72445_AdaptivePoll.hpp
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "SM72445_AdaptivePoll.hpp"
+
+using Tick = AdaptivePollController::Tick;
+using Reg1 = SM72445::Reg1;
+using Reg5 = SM72445::Reg5;
+
+using std::nullopt;
+
+AdaptivePollController::AdaptivePollController(
+	const SM72445 &sm72445,
+	Tick		   minInterval,
+	Tick		   maxInterval,
+	uint16_t	   approachBand
+)
+	: sm72445{sm72445},	   //
+	  minInterval{minInterval}, //
+	  maxInterval{maxInterval < minInterval ? minInterval : maxInterval},
+	  approachBand{approachBand}, //
+	  thresholds{},				  //
+	  interval{minInterval},	  //
+	  lastPoll{0u} {}
+
+optional<Reg5> AdaptivePollController::loadThresholds(void) {
+	auto reg5 = this->sm72445.getThresholdRegister();
+
+	if (!reg5) return nullopt;
+
+	this->thresholds = *reg5;
+	return reg5;
+}
+
+void AdaptivePollController::setThresholds(const Reg5 &reg5) {
+	this->thresholds = reg5;
+}
+
+static inline uint16_t distance(uint16_t a, uint16_t b) {
+	return a > b ? a - b : b - a;
+}
+
+static inline uint16_t nearest(uint16_t value, uint16_t low, uint16_t high) {
+	const uint16_t toLow  = distance(value, low);
+	const uint16_t toHigh = distance(value, high);
+	return toLow < toHigh ? toLow : toHigh;
+}
+
+uint16_t AdaptivePollController::getThresholdDistance(const Reg1 &reg1) const {
+	const uint16_t inputDistance = nearest(
+		reg1.iIn, //
+		this->thresholds.iInLow,
+		this->thresholds.iInHigh
+	);
+	const uint16_t outputDistance = nearest(
+		reg1.iOut, //
+		this->thresholds.iOutLow,
+		this->thresholds.iOutHigh
+	);
+	return inputDistance < outputDistance ? inputDistance : outputDistance;
+}
+
+Tick AdaptivePollController::getTargetInterval(uint16_t distance) const {
+	// Linear ramp from minInterval at the approach band to maxInterval at four bands.
+	const uint32_t nearLimit = this->approachBand;
+	const uint32_t farLimit	 = 4u * nearLimit;
+
+	if (distance <= nearLimit) return this->minInterval;
+	if (distance >= farLimit) return this->maxInterval;
+
+	const uint64_t span = this->maxInterval - this->minInterval;
+	return this->minInterval
+		 + static_cast<Tick>(span * (distance - nearLimit) / (farLimit - nearLimit));
+}
+
+Tick AdaptivePollController::update(const Reg1 &reg1) {
+	const Tick target = getTargetInterval(getThresholdDistance(reg1));
+
+	if (target <= this->interval) {
+		// Approaching a threshold, speed up immediately.
+		this->interval = target;
+	} else {
+		// Far from all thresholds, back off gradually.
+		// Clamp before doubling so a large maxInterval cannot wrap the tick count.
+		if (this->interval == 0u) this->interval = 1u;
+		else this->interval = this->interval > target / 2u ? target : this->interval * 2u;
+	}
+
+	return this->interval;
+}
+
+bool AdaptivePollController::isDue(Tick now) const {
+	// Unsigned subtraction tolerates tick counter wrap-around.
+	return static_cast<Tick>(now - this->lastPoll) >= this->interval;
+}
+
+optional<Reg1> AdaptivePollController::poll(Tick now) {
+	this->lastPoll = now;
+
+	auto reg1 = this->sm72445.getElectricalMeasurementsRegister();
+
+	if (!reg1) {
+		this->interval = this->minInterval;
+		return nullopt;
+	}
+
+	update(*reg1);
+	return reg1;
+}
+
+Tick AdaptivePollController::getInterval(void) const {
+	return this->interval;
+}
@@ -11,6 +11,7 @@
 using Register		= SM72445::Register;
 using Config		= SM72445_X::Config;
 using ConfigBuilder = SM72445_X::ConfigBuilder;
+using Calibration	= SM72445_X::Calibration;
 
 using PanelMode		= Config::PanelMode;
 using FrequencyMode = Config::FrequencyMode;
@@ -19,19 +20,18 @@ using DeadTime		= Config::DeadTime;
 static PanelMode	 getPanelModeFromBits(const uint8_t bits);
 static FrequencyMode getFrequencyModeFromBits(const uint8_t bits);
 
-Config::Config(const SM72445_X &sm72445, const Reg3 &reg3)
-	: sm72445(sm72445),													  //
-	  overrideAdcProgramming(reg3.overrideAdcProgramming),				  //
-	  frequencyMode(getFrequencyModeFromBits(reg3.a2Override)),			  //
-	  panelMode(getPanelModeFromBits(reg3.a2Override)),					  //
-	  iOutMax(reg3.iOutMax * sm72445.vDDA / sm72445.iOutGain / 0x3FFull), //
-	  vOutMax(reg3.vOutMax * sm72445.vDDA / sm72445.vOutGain / 0x3FFull), //
-	  tdOff(static_cast<DeadTime>(reg3.tdOff)),							  //
-	  tdOn(static_cast<DeadTime>(reg3.tdOn)),							  //
-	  panelModeOverrideEnable(reg3.passThroughSelect),					  //
-	  panelModeOverride(reg3.passThroughManual),						  //
-	  bbReset(reg3.bbReset),											  //
-	  clockOutputManualEnable(reg3.clkOeManual),						  //
+Config::Config(const Calibration &calibration, const Reg3 &reg3)
+	: overrideAdcProgramming(reg3.overrideAdcProgramming),						  //
+	  frequencyMode(getFrequencyModeFromBits(reg3.a2Override)),					  //
+	  panelMode(getPanelModeFromBits(reg3.a2Override)),							  //
+	  iOutMax(reg3.iOutMax * calibration.vDDA / calibration.iOutGain / 0x3FFull), //
+	  vOutMax(reg3.vOutMax * calibration.vDDA / calibration.vOutGain / 0x3FFull), //
+	  tdOff(static_cast<DeadTime>(reg3.tdOff)),									  //
+	  tdOn(static_cast<DeadTime>(reg3.tdOn)),									  //
+	  panelModeOverrideEnable(reg3.passThroughSelect),							  //
+	  panelModeOverride(reg3.passThroughManual),								  //
+	  bbReset(reg3.bbReset),													  //
+	  clockOutputManualEnable(reg3.clkOeManual),								  //
 	  openLoopOperation(reg3.openLoopOperation) {}
 
 ConfigBuilder::ConfigBuilder(const SM72445_X &sm72445, Reg3 reg3)
@@ -103,8 +103,10 @@ ConfigBuilder &ConfigBuilder::setPanelModeOverride(PanelMode panelMode) {
 }
 
 ConfigBuilder &ConfigBuilder::setMaxOutputCurrentOverride(float current) {
+	const Calibration &calibration = this->sm72445.getCalibration();
+
 	const uint16_t maxOutputCurrentAdcThreshold =
-		current * this->sm72445.iOutGain / this->sm72445.vDDA * 0x3FFull;
+		current * calibration.iOutGain / calibration.vDDA * 0x3FFull;
 
 	if (current < 0.0f || maxOutputCurrentAdcThreshold > 0x3FFu) {
 		// Invalid value, outside settable range. Default action set to zero.
@@ -118,8 +120,10 @@ ConfigBuilder &ConfigBuilder::setMaxOutputCurrentOverride(float current) {
 }
 
 ConfigBuilder &ConfigBuilder::setMaxOutputVoltageOverride(float voltage) {
+	const Calibration &calibration = this->sm72445.getCalibration();
+
 	const uint16_t maxOutputVoltageAdcThreshold =
-		voltage * this->sm72445.vOutGain / this->sm72445.vDDA * 0x3FFull;
+		voltage * calibration.vOutGain / calibration.vDDA * 0x3FFull;
 
 	if (voltage < 0.0f || maxOutputVoltageAdcThreshold > 0x3FFu) {
 		// Invalid value, outside settable range. Default action set to zero.
@@ -0,0 +1,63 @@
+/**
+ ******************************************************************************
+ * @file			: SM72445_ConfigTransaction.cpp
+ * @brief			: Source for SM72445 Configuration Transaction
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "SM72445_X.hpp"
+
+using Register			= SM72445::Register;
+using Reg3				= SM72445::Reg3;
+using ConfigBuilder		= SM72445_X::ConfigBuilder;
+using ConfigTransaction = SM72445_X::ConfigTransaction;
+using Status			= ConfigTransaction::Status;
+
+using std::nullopt;
+
+ConfigTransaction::ConfigTransaction(const SM72445_X &sm72445, optional<Reg3> image)
+	: sm72445(sm72445),
+	  image(image),
+	  builder(sm72445, image.value_or(Reg3())),
+	  status(image ? Status::PENDING : Status::FAILED) {}
+
+ConfigBuilder &ConfigTransaction::edit(void) { return this->builder; }
+
+Status ConfigTransaction::commit(void) {
+	if (this->status != Status::PENDING) return this->status;
+
+	const Register edited = this->builder.build();
+
+	if (edited == Register(*this->image)) {
+		this->status = Status::UNCHANGED;
+		return this->status;
+	}
+
+	if (this->sm72445.setConfig(edited)) {
+		this->image	 = Reg3(edited);
+		this->status = Status::WRITTEN;
+	} else {
+		this->image	 = nullopt; // The device may or may not hold the edited image.
+		this->status = Status::FAILED;
+	}
+	return this->status;
+}
+
+Status ConfigTransaction::verify(void) {
+	if (this->status != Status::WRITTEN) return this->status;
+
+	const auto readback = this->sm72445.getConfigRegister();
+
+	if (!readback) this->status = Status::FAILED;
+	else if (Register(*readback) != Register(*this->image)) {
+		this->image	 = readback;
+		this->status = Status::MISMATCH;
+	} else this->status = Status::VERIFIED;
+
+	return this->status;
+}
+
+Status ConfigTransaction::getStatus(void) const { return this->status; }
+
+optional<Reg3> ConfigTransaction::getImage(void) const { return this->image; }
@@ -0,0 +1,81 @@
+/**
+ ******************************************************************************
+ * @file			: SM72445_OffsetBuilder.cpp
+ * @brief			: Source for SM72445 Offset Register Builder
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "SM72445_X.hpp"
+
+using Register			 = SM72445::Register;
+using ElectricalProperty = SM72445::ElectricalProperty;
+using OffsetBuilder		 = SM72445_X::OffsetBuilder;
+
+OffsetBuilder::OffsetBuilder(const SM72445_X &sm72445, Reg4 reg4)
+	: sm72445(sm72445), reg4(reg4), countsPerUnit{}, dirty(0u) {
+	const float		   fullScale   = (1u << RESOLUTION) - 1u;
+	const Calibration &calibration = sm72445.getCalibration();
+
+	const array properties = {
+		ElectricalProperty::CURRENT_IN,
+		ElectricalProperty::VOLTAGE_IN,
+		ElectricalProperty::CURRENT_OUT,
+		ElectricalProperty::VOLTAGE_OUT,
+	};
+
+	for (auto property : properties) {
+		this->countsPerUnit[static_cast<uint8_t>(property)] =
+			calibration.getGain(property) / calibration.vDDA * fullScale;
+	}
+}
+
+OffsetBuilder &OffsetBuilder::setOffset(ElectricalProperty property, float offset) {
+	const uint8_t index = static_cast<uint8_t>(property);
+	if (index >= this->countsPerUnit.size()) return *this;
+
+	// Rounded rather than truncated, so that offsets read back with getOffset() rebuild
+	// to the same counts.
+	const float counts = offset * this->countsPerUnit[index] + 0.5f;
+
+	// Invalid value, outside settable range (or NaN). Default action set to zero.
+	const uint8_t value = (counts >= 0.5f && counts < 256.0f) ? uint8_t(counts) : 0u;
+
+	// Only fields which actually change need writing.
+	if (this->reg4[property] == value) return *this;
+
+	switch (property) {
+	case ElectricalProperty::CURRENT_IN:
+		this->reg4.iInOffset = value;
+		break;
+	case ElectricalProperty::VOLTAGE_IN:
+		this->reg4.vInOffset = value;
+		break;
+	case ElectricalProperty::CURRENT_OUT:
+		this->reg4.iOutOffset = value;
+		break;
+	case ElectricalProperty::VOLTAGE_OUT:
+		this->reg4.vOutOffset = value;
+		break;
+	}
+
+	this->dirty |= 1u << index;
+	return *this;
+}
+
+bool OffsetBuilder::isDirty(void) const { return this->dirty != 0u; }
+
+Register OffsetBuilder::build(void) const { return Register(this->reg4); }
+
+optional<Register> OffsetBuilder::commit(void) {
+	if (!isDirty()) return build();
+
+	auto written = this->sm72445.i2c.write(
+		this->sm72445.deviceAddress, //
+		MemoryAddress::REG4,
+		build()
+	);
+
+	if (written) this->dirty = 0u;
+	return written;
+}
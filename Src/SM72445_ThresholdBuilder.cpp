@@ -0,0 +1,84 @@
+/**
+ ******************************************************************************
+ * @file			: SM72445_ThresholdBuilder.cpp
+ * @brief			: Source for SM72445 Threshold Register Builder
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "SM72445_X.hpp"
+
+using Register		   = SM72445::Register;
+using CurrentThreshold = SM72445::CurrentThreshold;
+using ThresholdBuilder = SM72445_X::ThresholdBuilder;
+
+ThresholdBuilder::ThresholdBuilder(const SM72445_X &sm72445, Reg5 reg5)
+	: sm72445(sm72445), reg5(reg5), countsPerUnit{}, dirty(0u) {
+	const float		   fullScale   = (1u << RESOLUTION) - 1u;
+	const Calibration &calibration = sm72445.getCalibration();
+
+	const array thresholds = {
+		CurrentThreshold::CURRENT_OUT_LOW,
+		CurrentThreshold::CURRENT_OUT_HIGH,
+		CurrentThreshold::CURRENT_IN_LOW,
+		CurrentThreshold::CURRENT_IN_HIGH,
+	};
+
+	for (auto threshold : thresholds) {
+		this->countsPerUnit[static_cast<uint8_t>(threshold)] =
+			calibration.getGain(threshold) / calibration.vDDA * fullScale;
+	}
+}
+
+ThresholdBuilder &ThresholdBuilder::setCurrentThreshold(
+	CurrentThreshold threshold,
+	float			 current
+) {
+	const uint8_t index = static_cast<uint8_t>(threshold);
+	if (index >= this->countsPerUnit.size()) return *this;
+
+	// Rounded rather than truncated, so that thresholds read back with
+	// getCurrentThreshold() rebuild to the same counts.
+	const float counts = current * this->countsPerUnit[index] + 0.5f;
+
+	// Invalid value, outside settable range (or NaN). Default action set to zero.
+	const uint16_t value = (counts >= 0.5f && counts < 1024.0f) ? uint16_t(counts) : 0u;
+
+	// Only fields which actually change need writing.
+	if (this->reg5[threshold] == value) return *this;
+
+	switch (threshold) {
+	case CurrentThreshold::CURRENT_OUT_LOW:
+		this->reg5.iOutLow = value;
+		break;
+	case CurrentThreshold::CURRENT_OUT_HIGH:
+		this->reg5.iOutHigh = value;
+		break;
+	case CurrentThreshold::CURRENT_IN_LOW:
+		this->reg5.iInLow = value;
+		break;
+	case CurrentThreshold::CURRENT_IN_HIGH:
+		this->reg5.iInHigh = value;
+		break;
+	}
+
+	this->dirty |= 1u << index;
+	return *this;
+}
+
+bool ThresholdBuilder::isDirty(void) const { return this->dirty != 0u; }
+
+Register ThresholdBuilder::build(void) const { return Register(this->reg5); }
+
+optional<Register> ThresholdBuilder::commit(void) {
+	if (!isDirty()) return build();
+
+	auto written = this->sm72445.i2c.write(
+		this->sm72445.deviceAddress, //
+		MemoryAddress::REG5,
+		build()
+	);
+
+	if (written) this->dirty = 0u;
+	return written;
+}
@@ -0,0 +1,15 @@
+/**
+ ******************************************************************************
+ * @file			: SM72445_Trace.cpp
+ * @brief			: Source for SM72445_Trace.hpp
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "SM72445_Trace.hpp"
+
+#ifdef SM72445_TRACE
+
+std::atomic<SM72445_Trace::Hook> SM72445_Trace::hook{nullptr};
+
+#endif
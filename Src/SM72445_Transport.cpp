@@ -0,0 +1,146 @@
+/**
+ ******************************************************************************
+ * @file			: SM72445_Transport.cpp
+ * @brief			: Source for SM72445_Transport.hpp
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "SM72445_Transport.hpp"
+
+#include <cstring>
+
+using Register		= SM72445::Register;
+using DeviceAddress = SM72445::DeviceAddress;
+using MemoryAddress = SM72445::MemoryAddress;
+
+using std::nullopt;
+
+static constexpr Register DATA_MASK = 0x00FF'FFFF'FFFF'FFFFull; // The seven data bytes.
+
+static ByteSpan getFrame(ByteSpan frames, size_t index) {
+	return ByteSpan{frames.data + index * FramedI2C::FRAME_SIZE, FramedI2C::FRAME_SIZE};
+}
+
+void ByteTransport::readBatch(
+	const DeviceAddress *deviceAddresses,
+	size_t				 count,
+	MemoryAddress		 memoryAddress,
+	ByteSpan			 frames
+) {
+	for (size_t i = 0; i < count; i++) {
+		const ByteSpan frame = getFrame(frames, i);
+		if (!read(deviceAddresses[i], memoryAddress, frame)) frame.data[0] = 0u;
+	}
+}
+
+void ByteTransport::writeBatch(
+	const DeviceAddress *deviceAddresses,
+	size_t				 count,
+	MemoryAddress		 memoryAddress,
+	ByteSpan			 frames
+) {
+	for (size_t i = 0; i < count; i++) {
+		const ByteSpan frame = getFrame(frames, i);
+		if (!write(deviceAddresses[i], memoryAddress, frame)) frame.data[0] = 0u;
+	}
+}
+
+FramedI2C::FramedI2C(ByteTransport &transport) : transport{transport}, frame{} {}
+
+optional<Register> FramedI2C::read(
+	DeviceAddress deviceAddress, //
+	MemoryAddress memoryAddress
+) {
+	const ByteSpan frame{this->frame, FRAME_SIZE};
+
+	if (!this->transport.read(deviceAddress, memoryAddress, frame)) return nullopt;
+	return decode(frame);
+}
+
+optional<Register> FramedI2C::write(
+	DeviceAddress deviceAddress,
+	MemoryAddress memoryAddress,
+	Register	  data
+) {
+	const ByteSpan frame{this->frame, FRAME_SIZE};
+	encode(data, frame);
+
+	if (!this->transport.write(deviceAddress, memoryAddress, frame)) return nullopt;
+	return data & DATA_MASK;
+}
+
+size_t FramedI2C::readBatch(
+	const DeviceAddress *deviceAddresses,
+	size_t				 count,
+	MemoryAddress		 memoryAddress,
+	optional<Register>	*registers,
+	ByteSpan			 frames
+) {
+	if (frames.size / FRAME_SIZE < count) {
+		for (size_t i = 0; i < count; i++) registers[i] = nullopt;
+		return 0u;
+	}
+
+	this->transport.readBatch(deviceAddresses, count, memoryAddress, frames);
+
+	size_t read = 0u;
+	for (size_t i = 0; i < count; i++) {
+		registers[i] = decode(getFrame(frames, i));
+		if (registers[i]) read++;
+	}
+	return read;
+}
+
+size_t FramedI2C::writeBatch(
+	const DeviceAddress *deviceAddresses,
+	size_t				 count,
+	MemoryAddress		 memoryAddress,
+	const Register		*data,
+	optional<Register>	*written,
+	ByteSpan			 frames
+) {
+	for (size_t i = 0; i < count; i++) written[i] = nullopt;
+	if (frames.size / FRAME_SIZE < count) return 0u;
+
+	for (size_t i = 0; i < count; i++) encode(data[i], getFrame(frames, i));
+
+	this->transport.writeBatch(deviceAddresses, count, memoryAddress, frames);
+
+	size_t succeeded = 0u;
+	for (size_t i = 0; i < count; i++) {
+		if (frames.data[i * FRAME_SIZE] != DATA_LENGTH) continue; // Cleared on failure.
+
+		written[i] = data[i] & DATA_MASK;
+		succeeded++;
+	}
+	return succeeded;
+}
+
+optional<Register> FramedI2C::decode(ByteSpan frame) {
+	if (frame.size != FRAME_SIZE || frame.data[0] != DATA_LENGTH) return nullopt;
+
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+	// The length byte lands in the least significant byte, ahead of the data LSB first.
+	uint64_t word;
+	std::memcpy(&word, frame.data, sizeof(word));
+	return Register(word >> 8u);
+#else
+	Register reg = 0u;
+	for (size_t i = DATA_LENGTH; i > 0u; i--) reg = (reg << 8u) | frame.data[i];
+	return reg;
+#endif
+}
+
+bool FramedI2C::encode(Register data, ByteSpan frame) {
+	if (frame.size < FRAME_SIZE) return false;
+
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+	const uint64_t word = (data << 8u) | DATA_LENGTH;
+	std::memcpy(frame.data, &word, sizeof(word));
+#else
+	frame.data[0] = DATA_LENGTH;
+	for (size_t i = 1u; i < FRAME_SIZE; i++, data >>= 8u) frame.data[i] = uint8_t(data);
+#endif
+	return true;
+}
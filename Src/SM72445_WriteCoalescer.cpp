@@ -0,0 +1,81 @@
+/**
+ ******************************************************************************
+ * @file			: SM72445_WriteCoalescer.cpp
+ * @brief			: Source for SM72445_WriteCoalescer.hpp
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "SM72445_WriteCoalescer.hpp"
+
+using Register		 = SM72445::Register;
+using ConfigRegister = SM72445::ConfigRegister;
+using Reg3			 = SM72445::Reg3;
+
+using std::nullopt;
+
+ConfigWriteCoalescer::ConfigWriteCoalescer(const SM72445_X &sm72445, uint16_t maxStep)
+	: sm72445{sm72445}, //
+	  maxStep{maxStep}, //
+	  known{},			//
+	  pending{},		//
+	  coalesced{0u} {}
+
+optional<Reg3> ConfigWriteCoalescer::load(void) {
+	auto reg3 = this->sm72445.getConfigRegister();
+
+	if (!reg3) return nullopt;
+
+	this->known = *reg3;
+	return reg3;
+}
+
+void ConfigWriteCoalescer::setKnownImage(const Reg3 &reg3) { this->known = reg3; }
+
+void ConfigWriteCoalescer::submit(ConfigRegister configRegister) {
+	if (this->pending) this->coalesced++;
+	this->pending = Reg3(configRegister);
+}
+
+/**
+ * @brief Step a count towards a target by no more than maxStep.
+ */
+static uint16_t slew(uint16_t from, uint16_t to, uint16_t maxStep) {
+	if (to > from) return (to - from > maxStep) ? from + maxStep : to;
+	else return (from - to > maxStep) ? from - maxStep : to;
+}
+
+Reg3 ConfigWriteCoalescer::getNextImage(void) const {
+	Reg3 next = *this->pending;
+
+	if (this->maxStep && this->known) {
+		next.iOutMax = slew(this->known->iOutMax, next.iOutMax, this->maxStep);
+		next.vOutMax = slew(this->known->vOutMax, next.vOutMax, this->maxStep);
+	}
+	return next;
+}
+
+optional<Register> ConfigWriteCoalescer::flush(void) {
+	if (!this->pending) return nullopt;
+
+	const Reg3 next = getNextImage();
+
+	if (this->known && Register(next) == Register(*this->known)) {
+		this->pending = nullopt; // Already on the device.
+		return nullopt;
+	}
+
+	auto written = this->sm72445.setConfig(ConfigRegister(Register(next)));
+
+	if (!written) return nullopt;
+
+	this->known = next;
+	if (Register(next) == Register(*this->pending)) this->pending = nullopt;
+	return written;
+}
+
+bool ConfigWriteCoalescer::isPending(void) const { return this->pending.has_value(); }
+
+optional<Reg3> ConfigWriteCoalescer::getKnownImage(void) const { return this->known; }
+
+uint32_t ConfigWriteCoalescer::getCoalescedCount(void) const { return this->coalesced; }
@@ -7,6 +7,7 @@
  */
 
 #include "SM72445_X.hpp"
+#include "SM72445_Trace.hpp"
 
 using Register = SM72445::Register;
 
@@ -23,20 +24,54 @@ SM72445_X::SM72445_X(
 	float		  iOutGain,
 	float		  vDDA
 )
-	: SM72445(i2c, deviceAddress),												  //
-	  vInGain{vInGain}, vOutGain{vOutGain}, iInGain{iInGain}, iOutGain{iOutGain}, //
-	  vDDA{vDDA} {}
+	: SM72445_X(
+		  i2c,
+		  deviceAddress,
+		  Calibration{vInGain, vOutGain, iInGain, iOutGain, vDDA}
+	  ) {}
+
+SM72445_X::SM72445_X(
+	I2C				  &i2c,
+	DeviceAddress	   deviceAddress,
+	const Calibration &calibration
+)
+	: SM72445(i2c, deviceAddress),	   //
+	  defaultCalibration{calibration}, //
+	  calibration{&this->defaultCalibration} {}
+
+SM72445_X::SM72445_X(
+	I2C				  &i2c,
+	DeviceAddress	   deviceAddress,
+	const Calibration *calibration
+)
+	: SM72445(i2c, deviceAddress),		//
+	  defaultCalibration{*calibration}, //
+	  calibration{calibration} {}
+
+SM72445_X::SM72445_X(const SM72445_X &other)
+	: SM72445_X(other.i2c, other.deviceAddress, other.getCalibration()) {}
+
+const SM72445_X::Calibration *SM72445_X::setCalibration(const Calibration *calibration) {
+	if (!calibration) calibration = &this->defaultCalibration;
+
+	// No read-modify-write, which ARMv6-M lacks: the single writer owns the pointer.
+	const Calibration *previous = this->calibration.load(std::memory_order_relaxed);
+	this->calibration.store(calibration, std::memory_order_release);
+	return previous == &this->defaultCalibration ? nullptr : previous;
+}
 
 optional<Config> SM72445_X::getConfig(void) const {
 	auto regValues = getConfigRegister();
 
 	if (!regValues) return nullopt;
 
-	Config config(*this, *regValues);
+	Config config(getCalibration(), *regValues);
 	return config;
 }
 
 optional<Register> SM72445_X::setConfig(ConfigRegister configRegister) const {
+	SM72445_TRACE_SCOPE("SM72445_X::setConfig");
+
 	return this->i2c.write(this->deviceAddress, MemoryAddress::REG3, configRegister);
 }
 
@@ -105,38 +140,13 @@ static inline optional<float> getOptionalIndexOrNullopt(
 	return (*measurements)[index];
 }
 
-optional<array<float, 4>> SM72445_X::getElectricalMeasurements(void) const {
-	auto regValues = getElectricalMeasurementsRegister();
-
-	if (!regValues) return nullopt;
-
-	const array properties = {
-		ElectricalProperty::CURRENT_IN,
-		ElectricalProperty::VOLTAGE_IN,
-		ElectricalProperty::CURRENT_OUT,
-		ElectricalProperty::VOLTAGE_OUT,
-	};
-	array<float, 4> measurements;
-
-	for (auto property : properties) {
-		auto adcResult = regValues.value()[property];
-
-		const float gain = getGain(property);
-		if (gain == 0.0f) return nullopt; // Protect against divide by zero error.
-
-		const float measurement = convertAdcResultToPinVoltage(adcResult, 10u) / gain;
-
-		measurements[static_cast<uint8_t>(property)] = measurement;
-	}
-
-	return measurements;
-}
-
 optional<array<float, 4>> SM72445_X::getAnalogueChannelVoltages(void) const {
 	auto regValues = getAnalogueChannelRegister();
 
 	if (!regValues) return nullopt;
 
+	const float vDDA = getCalibration().vDDA;
+
 	array<float, 4> voltages;
 	const array		properties = {
 		AnalogueChannel::CH0,
@@ -148,7 +158,7 @@ optional<array<float, 4>> SM72445_X::getAnalogueChannelVoltages(void) const {
 	for (auto property : properties) {
 		const uint16_t adcResult = (*regValues)[property];
 
-		const float voltage = convertAdcResultToPinVoltage(adcResult, 10u);
+		const float voltage = convertAdcResultToPinVoltage(adcResult, 10u, vDDA);
 
 		voltages[static_cast<uint8_t>(property)] = voltage;
 	}
@@ -161,6 +171,8 @@ optional<array<float, 4>> SM72445_X::getOffsets(void) const {
 
 	if (!regValues) return nullopt;
 
+	const Calibration &calibration = getCalibration(); // One calibration throughout.
+
 	const array properties = {
 		ElectricalProperty::CURRENT_IN,
 		ElectricalProperty::VOLTAGE_IN,
@@ -173,10 +185,11 @@ optional<array<float, 4>> SM72445_X::getOffsets(void) const {
 	for (auto property : properties) {
 		const uint16_t adcOffset = (*regValues)[property];
 
-		const float gain = getGain(property);
+		const float gain = calibration.getGain(property);
 		if (gain == 0.0f) return nullopt; // Protect against divide by zero error.
 
-		const float offset = convertAdcResultToPinVoltage(adcOffset, 8u) / gain;
+		const float offset =
+			convertAdcResultToPinVoltage(adcOffset, 8u, calibration.vDDA) / gain;
 
 		offsets[static_cast<uint8_t>(property)] = offset;
 	}
@@ -189,6 +202,8 @@ optional<array<float, 4>> SM72445_X::getCurrentThresholds(void) const {
 
 	if (!thresholdRegValues) return nullopt;
 
+	const Calibration &calibration = getCalibration(); // One calibration throughout.
+
 	array<float, 4> thresholds;
 	const array		properties = {
 		CurrentThreshold::CURRENT_OUT_LOW,
@@ -200,10 +215,11 @@ optional<array<float, 4>> SM72445_X::getCurrentThresholds(void) const {
 	for (auto property : properties) {
 		const uint16_t adcThreshold = (*thresholdRegValues)[property];
 
-		const float gain = getGain(property);
+		const float gain = calibration.getGain(property);
 		if (gain == 0.0f) return nullopt; // Protect against divide by zero error.
 
-		const float threshold = convertAdcResultToPinVoltage(adcThreshold, 10u) / gain;
+		const float threshold =
+			convertAdcResultToPinVoltage(adcThreshold, 10u, calibration.vDDA) / gain;
 
 		thresholds[static_cast<uint8_t>(property)] = threshold;
 	}
@@ -221,31 +237,40 @@ SM72445_X::ConfigBuilder SM72445_X::getConfigBuilder(bool fetchCurrentConfig) co
 	return configBuilder;
 }
 
-float SM72445_X::convertAdcResultToPinVoltage(uint16_t adcResult, uint8_t resolution)
-	const {
-	// ! adcResult is not checked for valid range with respect to resolution here.
-	// Ensure proper masking before calling this function.
-	const float maxAdcResult = (1u << resolution) - 1u;
-	float		voltage		 = adcResult / maxAdcResult * this->vDDA;
-	return voltage;
+SM72445_X::ConfigTransaction SM72445_X::beginConfigTransaction(void) const {
+	return ConfigTransaction(*this, getConfigRegister());
 }
 
-float SM72445_X::getGain(SM72445::ElectricalProperty property) const {
-	switch (property) {
-	case ElectricalProperty::CURRENT_IN:
-		return this->iInGain;
-	case ElectricalProperty::VOLTAGE_IN:
-		return this->vInGain;
-	case ElectricalProperty::CURRENT_OUT:
-		return this->iOutGain;
-	case ElectricalProperty::VOLTAGE_OUT:
-		return this->vOutGain;
-	default:
-		return 0.0;
+SM72445_X::ConfigTransaction SM72445_X::beginConfigTransaction(Reg3 image) const {
+	return ConfigTransaction(*this, image);
+}
+
+SM72445_X::OffsetBuilder SM72445_X::getOffsetBuilder(bool fetchCurrentOffsets) const {
+	if (fetchCurrentOffsets) {
+		auto regValues = getOffsetRegister();
+
+		if (regValues) return OffsetBuilder(*this, *regValues);
+	}
+	OffsetBuilder offsetBuilder(*this);
+	return offsetBuilder;
+}
+
+SM72445_X::ThresholdBuilder SM72445_X::getThresholdBuilder(bool fetchCurrentThresholds
+) const {
+	if (fetchCurrentThresholds) {
+		auto regValues = getThresholdRegister();
+
+		if (regValues) return ThresholdBuilder(*this, *regValues);
 	}
+	ThresholdBuilder thresholdBuilder(*this);
+	return thresholdBuilder;
 }
 
 float SM72445_X::getGain(SM72445::CurrentThreshold threshold) const {
+	return getCalibration().getGain(threshold);
+}
+
+float SM72445_X::Calibration::getGain(SM72445::CurrentThreshold threshold) const {
 	switch (threshold) {
 	case CurrentThreshold::CURRENT_OUT_LOW:
 	case CurrentThreshold::CURRENT_OUT_HIGH:
@@ -257,3 +282,11 @@ float SM72445_X::getGain(SM72445::CurrentThreshold threshold) const {
 		return 0.0;
 	}
 }
+
+bool SM72445_X::Calibration::operator==(const Calibration &other) const {
+	return this->vInGain == other.vInGain	  //
+		&& this->vOutGain == other.vOutGain //
+		&& this->iInGain == other.iInGain	  //
+		&& this->iOutGain == other.iOutGain //
+		&& this->vDDA == other.vDDA;
+}
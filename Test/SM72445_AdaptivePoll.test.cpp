@@ -0,0 +1,118 @@
+/**
+ ******************************************************************************
+ * @file			: SM72445_AdaptivePoll.test.cpp
+ * @brief			: Tests for the SM72445 Adaptive Poll Controller.
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "SM72445.test.hpp"
+
+#include <limits>
+
+#include "SM72445_AdaptivePoll.hpp"
+
+using ::testing::_;
+using ::testing::Eq;
+using ::testing::Return;
+
+using Register		= SM72445::Register;
+using MemoryAddress = SM72445::MemoryAddress;
+using Reg1			= SM72445::Reg1;
+using Reg5			= SM72445::Reg5;
+
+using std::nullopt;
+
+class SM72445_AdaptivePoll : public SM72445_Test {
+public:
+	// Thresholds: iOutLow = 100, iOutHigh = 200, iInLow = 300, iInHigh = 400.
+	const Reg5 thresholds{100u, 200u, 300u, 400u};
+
+	AdaptivePollController controller{sm72445, 10u, 1000u, 20u};
+};
+
+TEST_F(SM72445_AdaptivePoll, loadThresholdsReadsReg5Once) {
+	EXPECT_CALL(i2c, read(_, Eq(MemoryAddress::REG5)))
+		.WillOnce(Return(Register(thresholds)));
+
+	auto reg5 = controller.loadThresholds();
+	ASSERT_TRUE(reg5.has_value());
+	EXPECT_EQ(Register(*reg5), Register(thresholds));
+}
+
+TEST_F(SM72445_AdaptivePoll, loadThresholdsReturnsNulloptIfI2CReadFails) {
+	disableI2C();
+	EXPECT_EQ(controller.loadThresholds(), nullopt);
+}
+
+TEST_F(SM72445_AdaptivePoll, getThresholdDistanceUsesNearestThreshold) {
+	controller.setThresholds(thresholds);
+
+	EXPECT_EQ(controller.getThresholdDistance(Reg1{390u, 0u, 150u, 0u}), 10u);
+	EXPECT_EQ(controller.getThresholdDistance(Reg1{350u, 0u, 105u, 0u}), 5u);
+	EXPECT_EQ(controller.getThresholdDistance(Reg1{1000u, 0u, 600u, 0u}), 400u);
+}
+
+TEST_F(SM72445_AdaptivePoll, updateSpeedsUpImmediatelyNearThreshold) {
+	controller.setThresholds(thresholds);
+
+	// Far from all thresholds, back off to the maximum interval.
+	for (int i = 0; i < 10; i++) controller.update(Reg1{700u, 0u, 700u, 0u});
+	EXPECT_EQ(controller.getInterval(), 1000u);
+
+	EXPECT_EQ(controller.update(Reg1{305u, 0u, 700u, 0u}), 10u);
+}
+
+TEST_F(SM72445_AdaptivePoll, updateBacksOffGraduallyWhenFarFromThresholds) {
+	controller.setThresholds(thresholds);
+
+	EXPECT_EQ(controller.update(Reg1{700u, 0u, 700u, 0u}), 20u);
+	EXPECT_EQ(controller.update(Reg1{700u, 0u, 700u, 0u}), 40u);
+	EXPECT_EQ(controller.update(Reg1{700u, 0u, 700u, 0u}), 80u);
+}
+
+TEST_F(SM72445_AdaptivePoll, updateBackOffDoesNotOverflowLargeMaximum) {
+	using Tick = AdaptivePollController::Tick;
+	const Tick maxTick = std::numeric_limits<Tick>::max();
+
+	AdaptivePollController wide{sm72445, 10u, maxTick, 20u};
+	wide.setThresholds(thresholds);
+
+	Tick previous = wide.getInterval();
+	for (int i = 0; i < 40; i++) {
+		const Tick interval = wide.update(Reg1{700u, 0u, 700u, 0u});
+		EXPECT_GE(interval, previous);
+		previous = interval;
+	}
+	EXPECT_EQ(wide.getInterval(), maxTick);
+}
+
+TEST_F(SM72445_AdaptivePoll, updateRampsTargetIntervalWithinApproachRange) {
+	controller.setThresholds(thresholds);
+
+	// Halfway between one band (20) and four bands (80) from the nearest threshold.
+	for (int i = 0; i < 10; i++) controller.update(Reg1{350u, 0u, 150u, 0u});
+	EXPECT_EQ(controller.getInterval(), 10u + (1000u - 10u) / 2u);
+}
+
+TEST_F(SM72445_AdaptivePoll, pollReadsReg1AndUpdatesInterval) {
+	controller.setThresholds(thresholds);
+
+	EXPECT_CALL(i2c, read(_, Eq(MemoryAddress::REG1)))
+		.WillOnce(Return(Register(Reg1{700u, 0u, 700u, 0u})));
+
+	EXPECT_TRUE(controller.isDue(10u));
+	ASSERT_TRUE(controller.poll(10u).has_value());
+	EXPECT_EQ(controller.getInterval(), 20u);
+	EXPECT_FALSE(controller.isDue(29u));
+	EXPECT_TRUE(controller.isDue(30u));
+}
+
+TEST_F(SM72445_AdaptivePoll, pollFallsBackToMinimumIntervalIfI2CReadFails) {
+	controller.setThresholds(thresholds);
+	for (int i = 0; i < 10; i++) controller.update(Reg1{700u, 0u, 700u, 0u});
+
+	disableI2C();
+	EXPECT_EQ(controller.poll(0u), nullopt);
+	EXPECT_EQ(controller.getInterval(), 10u);
+}
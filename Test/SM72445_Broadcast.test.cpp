@@ -0,0 +1,167 @@
+/**
+ ******************************************************************************
+ * @file			: SM72445_Broadcast.test.cpp
+ * @brief			: Tests for the fleet-wide configuration broadcast.
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "SM72445_X.test.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+
+#include "SM72445_Broadcast.hpp"
+
+using ::testing::_;
+using ::testing::Eq;
+using ::testing::InSequence;
+using ::testing::Return;
+using ::testing::ReturnArg;
+
+using Register		= SM72445::Register;
+using DeviceAddress = SM72445::DeviceAddress;
+using MemoryAddress = SM72445::MemoryAddress;
+
+using std::nullopt;
+
+class SM72445_Broadcast : public SM72445_X_Test {
+public:
+	MockedI2C i2cB{};
+
+	SM72445_X a1{i2c, DeviceAddress::ADDR001, .5f, .5f, .5f, .5f};
+	SM72445_X a2{i2c, DeviceAddress::ADDR010, .5f, .5f, .5f, .4f};
+	SM72445_X b1{i2cB, DeviceAddress::ADDR001, .5f, .5f, .5f, .2f};
+
+	ConfigBroadcast broadcast{{{&a1, &a2}, {&b1}}};
+};
+
+TEST_F(SM72445_Broadcast, writesEveryDeviceBackToBackPerBus) {
+	const Register config = 0x1234ull;
+	{
+		InSequence sequence;
+		EXPECT_CALL(i2c, write(Eq(DeviceAddress::ADDR001), _, Eq(config)))
+			.WillOnce(ReturnArg<2>());
+		EXPECT_CALL(i2c, write(Eq(DeviceAddress::ADDR010), _, Eq(config)))
+			.WillOnce(ReturnArg<2>());
+	}
+	EXPECT_CALL(i2cB, write(Eq(DeviceAddress::ADDR001), Eq(MemoryAddress::REG3), config))
+		.WillOnce(ReturnArg<2>());
+	EXPECT_CALL(i2c, read(_, _)).Times(0);
+
+	const auto report = broadcast.broadcast(config);
+
+	EXPECT_EQ(broadcast.getDeviceCount(), 3u);
+	EXPECT_EQ(report.succeeded, 3u);
+	EXPECT_EQ(report.failed, 0u);
+	ASSERT_EQ(report.written.size(), 2u);
+	EXPECT_EQ(report.written[0][1], config);
+	EXPECT_EQ(report.written[1][0], config);
+}
+
+TEST_F(SM72445_Broadcast, perDeviceImagesFollowEachDevicesCalibration) {
+	EXPECT_CALL(i2c, write(_, _, _)).Times(2).WillRepeatedly(ReturnArg<2>());
+	EXPECT_CALL(i2cB, write(_, _, _)).WillOnce(ReturnArg<2>());
+
+	const auto report = broadcast.broadcast([](const SM72445_X &device) {
+		return device.getConfigBuilder().setMaxOutputCurrentOverride(1.0f).build();
+	});
+
+	ASSERT_EQ(report.succeeded, 3u);
+	const auto iOutMax = [](optional<Register> written) {
+		return SM72445::Reg3(*written).iOutMax;
+	};
+	EXPECT_GT(iOutMax(report.written[0][0]), iOutMax(report.written[0][1]));
+	EXPECT_GT(iOutMax(report.written[0][1]), iOutMax(report.written[1][0]));
+}
+
+TEST_F(SM72445_Broadcast, failuresAreReportedPerDevice) {
+	EXPECT_CALL(i2c, write(Eq(DeviceAddress::ADDR001), _, _)).WillOnce(ReturnArg<2>());
+	EXPECT_CALL(i2c, write(Eq(DeviceAddress::ADDR010), _, _)).WillOnce(Return(nullopt));
+	EXPECT_CALL(i2cB, write(_, _, _)).WillOnce(ReturnArg<2>());
+
+	const auto report = broadcast.broadcast(Register(0x0ull));
+
+	EXPECT_EQ(report.succeeded, 2u);
+	EXPECT_EQ(report.failed, 1u);
+	EXPECT_NE(report.written[0][0], nullopt);
+	EXPECT_EQ(report.written[0][1], nullopt);
+	EXPECT_NE(report.written[1][0], nullopt);
+}
+
+TEST_F(SM72445_Broadcast, throwingBusIsReportedWithoutStoppingOtherBuses) {
+	EXPECT_CALL(i2c, write(Eq(DeviceAddress::ADDR001), _, _))
+		.WillOnce([](DeviceAddress, MemoryAddress, Register) -> optional<Register> {
+			throw std::runtime_error("bus fault");
+		})
+		.WillOnce(ReturnArg<2>());
+	// Only reached by the second broadcast.
+	EXPECT_CALL(i2c, write(Eq(DeviceAddress::ADDR010), _, _)).WillOnce(ReturnArg<2>());
+	EXPECT_CALL(i2cB, write(_, _, _)).Times(2).WillRepeatedly(ReturnArg<2>());
+
+	const auto report = broadcast.broadcast(Register(0x0ull));
+
+	ASSERT_EQ(report.errors.size(), 2u);
+	EXPECT_THROW(std::rethrow_exception(report.errors[0]), std::runtime_error);
+	EXPECT_EQ(report.errors[1], nullptr);
+	EXPECT_EQ(report.succeeded, 1u);
+	EXPECT_EQ(report.failed, 2u);
+
+	// The workers survive to serve the next broadcast.
+	EXPECT_EQ(broadcast.broadcast(Register(0x0ull)).succeeded, 3u);
+}
+
+/**
+ * @brief An I2C whose writes block until every bus has a write in flight, or timeout.
+ */
+class RendezvousI2C : public SM72445::I2C {
+	std::atomic<size_t> &inFlight;
+	const size_t		 buses;
+
+public:
+	bool met = false;
+
+	RendezvousI2C(std::atomic<size_t> &inFlight, size_t buses)
+		: inFlight{inFlight}, buses{buses} {}
+
+	virtual optional<Register> read(DeviceAddress, MemoryAddress) override final {
+		return nullopt;
+	}
+
+	virtual optional<Register> write(DeviceAddress, MemoryAddress, Register data)
+		override final {
+		const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+
+		this->inFlight++;
+		while (this->inFlight.load() < this->buses) {
+			if (std::chrono::steady_clock::now() > deadline) return nullopt;
+			std::this_thread::yield();
+		}
+		this->met = true;
+		return data;
+	}
+};
+
+TEST(SM72445_BroadcastParallel, busesAreWrittenConcurrently) {
+	constexpr size_t	BUSES = 4u;
+	std::atomic<size_t> inFlight{0u};
+
+	std::vector<std::unique_ptr<RendezvousI2C>> i2cs;
+	std::vector<std::unique_ptr<SM72445_X>>		devices;
+	std::vector<ConfigBroadcast::Bus>			buses;
+	for (size_t i = 0; i < BUSES; i++) {
+		i2cs.emplace_back(new RendezvousI2C{inFlight, BUSES});
+		devices.emplace_back(
+			new SM72445_X{*i2cs.back(), DeviceAddress::ADDR001, .5f, .5f, .5f, .5f}
+		);
+		buses.push_back({devices.back().get()});
+	}
+
+	const auto report = ConfigBroadcast{buses}.broadcast(Register(0x0ull));
+
+	EXPECT_EQ(report.succeeded, BUSES);
+	for (const auto &i2c : i2cs) EXPECT_TRUE(i2c->met);
+}
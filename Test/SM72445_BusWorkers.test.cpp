@@ -0,0 +1,92 @@
+/**
+ ******************************************************************************
+ * @file			: SM72445_BusWorkers.test.cpp
+ * @brief			: Tests for the persistent per-bus worker threads.
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "SM72445_BusWorkers.hpp"
+
+TEST(SM72445_BusWorkers, runsTaskOnceForEveryBus) {
+	BusWorkers workers{4u};
+
+	std::vector<std::atomic<int>> calls(4u);
+	const auto errors = workers.run([&](size_t bus) { calls[bus]++; });
+
+	ASSERT_EQ(errors.size(), 4u);
+	for (size_t bus = 0; bus < 4u; bus++) {
+		EXPECT_EQ(calls[bus].load(), 1);
+		EXPECT_EQ(errors[bus], nullptr);
+	}
+}
+
+TEST(SM72445_BusWorkers, threadsPersistBetweenRuns) {
+	BusWorkers workers{3u};
+
+	std::vector<std::thread::id> first(3u), second(3u);
+	workers.run([&](size_t bus) { first[bus] = std::this_thread::get_id(); });
+	workers.run([&](size_t bus) { second[bus] = std::this_thread::get_id(); });
+
+	EXPECT_EQ(first, second);
+	EXPECT_EQ(first[0], std::this_thread::get_id()); // The caller serves bus 0.
+	EXPECT_EQ(std::set<std::thread::id>(first.begin(), first.end()).size(), 3u);
+}
+
+TEST(SM72445_BusWorkers, busesRunConcurrently) {
+	constexpr size_t BUSES = 4u;
+	BusWorkers		 workers{BUSES};
+
+	std::atomic<size_t> arrived{0u};
+	std::atomic<size_t> met{0u};
+
+	workers.run([&](size_t) {
+		const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+
+		arrived++;
+		while (arrived.load() < BUSES) {
+			if (std::chrono::steady_clock::now() > deadline) return;
+			std::this_thread::yield();
+		}
+		met++;
+	});
+
+	EXPECT_EQ(met.load(), BUSES);
+}
+
+TEST(SM72445_BusWorkers, exceptionsAreCapturedPerBus) {
+	BusWorkers workers{3u};
+
+	std::atomic<int> completed{0};
+	const auto		 errors = workers.run([&](size_t bus) {
+		  if (bus != 1u) throw std::runtime_error("bus fault");
+		  completed++;
+	  });
+
+	EXPECT_THROW(std::rethrow_exception(errors[0]), std::runtime_error);
+	EXPECT_EQ(errors[1], nullptr);
+	EXPECT_THROW(std::rethrow_exception(errors[2]), std::runtime_error);
+	EXPECT_EQ(completed.load(), 1);
+
+	// Workers which threw still serve later runs.
+	const auto next = workers.run([&](size_t) { completed++; });
+	EXPECT_EQ(completed.load(), 4);
+	for (const auto &error : next) EXPECT_EQ(error, nullptr);
+}
+
+TEST(SM72445_BusWorkers, noBusesRunsNothing) {
+	BusWorkers workers{0u};
+
+	bool called = false;
+	EXPECT_TRUE(workers.run([&](size_t) { called = true; }).empty());
+	EXPECT_FALSE(called);
+}
@@ -0,0 +1,108 @@
+/**
+ ******************************************************************************
+ * @file			: SM72445_Calibration.test.cpp
+ * @brief			: Tests for publishing calibrations to a live SM72445_X.
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "SM72445_X.test.hpp"
+
+#include <atomic>
+#include <thread>
+
+using ::testing::_;
+using ::testing::Eq;
+using ::testing::Return;
+
+using Register		   = SM72445::Register;
+using Reg1			   = SM72445::Reg1;
+using Reg3			   = SM72445::Reg3;
+using Reg5			   = SM72445::Reg5;
+using MemoryAddress	   = SM72445::MemoryAddress;
+using CurrentThreshold = SM72445::CurrentThreshold;
+using Calibration	   = SM72445_X::Calibration;
+
+class SM72445_Calibration : public SM72445_X_Test {
+public:
+	const Calibration unity{1.0f, 1.0f, 1.0f, 1.0f, 5.0f};
+	const Calibration skewed{1.0f, 2.0f, 4.0f, 8.0f, 2.5f};
+
+	const Reg1 fullScale{0x3FFu, 0x3FFu, 0x3FFu, 0x3FFu};
+};
+
+TEST_F(SM72445_Calibration, publishedCalibrationConvertsMeasurements) {
+	EXPECT_EQ(sm72445.convertElectricalMeasurements(fullScale)->at(0), 10.0f);
+
+	EXPECT_EQ(sm72445.setCalibration(&unity), nullptr); // The constructor's calibration.
+	EXPECT_EQ(&sm72445.getCalibration(), &unity);
+	EXPECT_EQ(sm72445.convertElectricalMeasurements(fullScale)->at(0), 5.0f);
+
+	EXPECT_EQ(sm72445.setCalibration(&skewed), &unity);
+	EXPECT_EQ(sm72445.setCalibration(nullptr), &skewed);
+	EXPECT_EQ(sm72445.getCalibration().vInGain, .5f);
+	EXPECT_EQ(sm72445.convertElectricalMeasurements(fullScale)->at(0), 10.0f);
+}
+
+TEST_F(SM72445_Calibration, copiesOwnTheCalibrationInUse) {
+	sm72445.setCalibration(&skewed);
+	SM72445_X copy{sm72445};
+	sm72445.setCalibration(nullptr);
+
+	EXPECT_NE(&copy.getCalibration(), &skewed);
+	EXPECT_EQ(copy.getCalibration().iOutGain, 8.0f);
+	EXPECT_EQ(copy.setCalibration(nullptr), nullptr);
+	EXPECT_EQ(copy.getCalibration().vDDA, 2.5f);
+}
+
+TEST_F(SM72445_Calibration, readersAndBuildersUseThePublishedCalibration) {
+	EXPECT_CALL(i2c, read(_, Eq(MemoryAddress::REG5)))
+		.WillOnce(Return(Register(Reg5(0x3FFu, 0x3FFu, 0x3FFu, 0x3FFu))));
+
+	sm72445.setCalibration(&unity);
+
+	EXPECT_EQ(sm72445.getCurrentThresholds()->at(0), 5.0f);
+
+	// 204.6 counts per Amp at a gain of 1 and vDDA of 5V, rather than 102.3.
+	auto configBuilder = sm72445.getConfigBuilder(false);
+	configBuilder.setMaxOutputCurrentOverride(2.0f);
+	EXPECT_EQ(Reg3(configBuilder.build()).iOutMax, 409u);
+
+	auto thresholdBuilder = sm72445.getThresholdBuilder(false);
+	sm72445.setCalibration(nullptr); // Not seen by the builder.
+	thresholdBuilder.setCurrentThreshold(CurrentThreshold::CURRENT_OUT_HIGH, 1.0f);
+	EXPECT_EQ(Reg5(thresholdBuilder.build()).iOutHigh, 205u);
+}
+
+TEST_F(SM72445_Calibration, pollingContinuesWhileCalibrationsArePublished) {
+	sm72445.setCalibration(&unity);
+
+	const Reg1 reg1{100u, 200u, 300u, 400u};
+
+	sm72445.setCalibration(&skewed);
+	const auto expectedSkewed = sm72445.convertElectricalMeasurements(reg1);
+	sm72445.setCalibration(&unity);
+	const auto expectedUnity = sm72445.convertElectricalMeasurements(reg1);
+	ASSERT_NE(expectedSkewed, expectedUnity);
+
+	std::atomic<bool> done{false};
+	std::thread		  publisher{[&](void) {
+		  for (size_t i = 0; !done.load(); i++) {
+			  sm72445.setCalibration(i % 2u ? &skewed : &unity);
+		  }
+	  }};
+
+	// Every conversion uses one whole calibration, never a mix of the two.
+	size_t skewedCount = 0u, unityCount = 0u;
+	for (size_t i = 0; i < 200'000u; i++) {
+		const auto measurements = sm72445.convertElectricalMeasurements(reg1);
+		if (measurements == expectedSkewed) skewedCount++;
+		else if (measurements == expectedUnity) unityCount++;
+		else ADD_FAILURE() << "Torn calibration at conversion " << i;
+	}
+
+	done.store(true);
+	publisher.join();
+
+	EXPECT_EQ(skewedCount + unityCount, 200'000u);
+}
@@ -0,0 +1,126 @@
+/**
+ ******************************************************************************
+ * @file			: SM72445_CalibrationPublisher.test.cpp
+ * @brief			: Tests for epoch-reclaimed calibration publishing.
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "SM72445_X.test.hpp"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "SM72445_CalibrationPublisher.hpp"
+
+using Reg1		  = SM72445::Reg1;
+using Calibration = CalibrationPublisher::Calibration;
+using Reader	  = CalibrationPublisher::Reader;
+
+class SM72445_CalibrationPublisher : public SM72445_X_Test {
+public:
+	const Calibration revA{.5f, .5f, .5f, .5f};
+	const Calibration revB{.5f, .4f, .3f, .2f, 3.3f};
+
+	CalibrationPublisher publisher{};
+
+	void TearDown(void) override { publisher.restore(sm72445); }
+};
+
+TEST_F(SM72445_CalibrationPublisher, publishedCalibrationIsInUse) {
+	publisher.publish(sm72445, revB);
+	EXPECT_EQ(sm72445.getCalibration(), revB);
+
+	publisher.publish(sm72445, revA);
+	EXPECT_EQ(sm72445.getCalibration(), revA);
+	EXPECT_EQ(publisher.reclaim(), 0u); // No reader could hold the replaced block.
+
+	publisher.restore(sm72445);
+	EXPECT_EQ(sm72445.getCalibration(), revA); // The constructor's calibration.
+	EXPECT_EQ(publisher.reclaim(), 0u);
+}
+
+TEST_F(SM72445_CalibrationPublisher, pinnedBlocksOutliveReplacement) {
+	publisher.publish(sm72445, revB);
+
+	auto reader = publisher.addReader();
+	ASSERT_TRUE(reader);
+	{
+		const auto		   guard	   = reader->pin();
+		const Calibration &calibration = sm72445.getCalibration();
+
+		publisher.publish(sm72445, revA);
+		publisher.restore(sm72445);
+		EXPECT_EQ(publisher.reclaim(), 2u); // Both retired while pinned.
+
+		EXPECT_EQ(calibration, revB);
+	}
+	EXPECT_EQ(publisher.reclaim(), 0u);
+}
+
+TEST_F(SM72445_CalibrationPublisher, pinsAfterReplacementDoNotDelayReclamation) {
+	auto early = publisher.addReader();
+	auto late  = publisher.addReader();
+	ASSERT_TRUE(early && late);
+
+	publisher.publish(sm72445, revB);
+
+	optional<CalibrationPublisher::Guard> earlyGuard{early->pin()};
+	publisher.publish(sm72445, revA);
+
+	const auto lateGuard = late->pin(); // Can only load revA, or later.
+	EXPECT_EQ(publisher.reclaim(), 1u);
+
+	earlyGuard.reset();
+	EXPECT_EQ(publisher.reclaim(), 0u);
+}
+
+TEST_F(SM72445_CalibrationPublisher, blocksPublishedElsewhereAreNotFreed) {
+	static const Calibration external{.5f, .4f, .3f, .2f, 3.3f};
+	sm72445.setCalibration(&external);
+
+	publisher.publish(sm72445, revA);
+	EXPECT_EQ(publisher.reclaim(), 0u);
+	EXPECT_EQ(external, revB);
+}
+
+TEST_F(SM72445_CalibrationPublisher, readersAreLimited) {
+	std::vector<Reader> readers;
+	while (auto reader = publisher.addReader()) readers.push_back(std::move(*reader));
+
+	EXPECT_EQ(readers.size(), CalibrationPublisher::MAX_READERS);
+
+	readers.pop_back();
+	EXPECT_TRUE(publisher.addReader());
+}
+
+TEST_F(SM72445_CalibrationPublisher, pollersConvertWhileCalibrationsAreReplaced) {
+	const Reg1 reg1(100u, 200u, 300u, 400u);
+
+	const SM72445_X deviceA{i2c, SM72445::DeviceAddress::ADDR001, revA};
+	const SM72445_X deviceB{i2c, SM72445::DeviceAddress::ADDR001, revB};
+	const auto		expectedA = deviceA.convertElectricalMeasurements(reg1);
+	const auto		expectedB = deviceB.convertElectricalMeasurements(reg1);
+
+	std::atomic<bool> done{false};
+	std::thread		  maintainer{[&](void) {
+		  for (size_t i = 0; !done.load(); i++) {
+			  publisher.publish(sm72445, i % 2u ? revA : revB);
+		  }
+	  }};
+
+	// Every conversion uses one whole calibration, whose block is never freed under it.
+	auto reader = publisher.addReader();
+	for (size_t cycle = 0; cycle < 20'000u; cycle++) {
+		const auto guard	  = reader->pin();
+		const auto converted = sm72445.convertElectricalMeasurements(reg1);
+		EXPECT_TRUE(converted == expectedA || converted == expectedB);
+	}
+
+	done.store(true);
+	maintainer.join();
+
+	reader.reset();
+	EXPECT_EQ(publisher.reclaim(), 0u);
+}
@@ -201,6 +201,20 @@ TEST_F(SM72445_Config, getConfigReturnsExpectedConfig) {
 	}
 }
 
+TEST_F(SM72445_Config, configIsAnAssignableValueIndependentOfItsDevice) {
+	EXPECT_CALL(i2c, read).WillOnce(Return(0x0ull)).WillOnce(Return(0x3FFull << 30u));
+
+	optional<Config> config;
+	{
+		const SM72445_X device{i2c, SM72445::DeviceAddress::ADDR010, .5f, .5f, .5f, .4f};
+		config = device.getConfig();
+		config = device.getConfig(); // Assignment of a Config was not possible before.
+	}
+
+	ASSERT_TRUE(config.has_value());
+	EXPECT_FLOAT_EQ(config->iOutMax, 5.0f / .4f); // Full scale.
+}
+
 TEST_F(SM72445_Config, setConfigNormallyWritesValuesToReg3) {
 	const Register testReg3Value = 0x1ull;
 	EXPECT_CALL(i2c, write(_, Eq(SM72445::MemoryAddress::REG3), _))
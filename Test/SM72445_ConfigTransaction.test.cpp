@@ -0,0 +1,113 @@
+/**
+ ******************************************************************************
+ * @file			: SM72445_ConfigTransaction.test.cpp
+ * @brief			: Tests for SM72445_X::ConfigTransaction.
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "SM72445_X.test.hpp"
+
+using ::testing::_;
+using ::testing::Eq;
+using ::testing::Return;
+
+using Register		= SM72445::Register;
+using Reg3			= SM72445::Reg3;
+using MemoryAddress = SM72445::MemoryAddress;
+
+using ConfigTransaction = SM72445_X::ConfigTransaction;
+using Status			= ConfigTransaction::Status;
+using PanelMode			= SM72445_X::Config::PanelMode;
+
+using std::nullopt;
+
+class SM72445_ConfigTransaction : public SM72445_X_Test {
+public:
+	const Register initial = Register(Reg3());
+	const Register edited =
+		sm72445.getConfigBuilder().setPanelModeOverride(PanelMode::USE_H_BRIDGE).build();
+};
+
+TEST_F(SM72445_ConfigTransaction, readsOnceAndWritesOnceWhenChanged) {
+	EXPECT_CALL(i2c, read(_, Eq(MemoryAddress::REG3))).WillOnce(Return(initial));
+	EXPECT_CALL(i2c, write(_, Eq(MemoryAddress::REG3), Eq(edited)))
+		.WillOnce(Return(edited));
+
+	auto transaction = sm72445.beginConfigTransaction();
+	EXPECT_EQ(transaction.getStatus(), Status::PENDING);
+
+	transaction.edit().setPanelModeOverride(PanelMode::USE_H_BRIDGE);
+	EXPECT_EQ(transaction.commit(), Status::WRITTEN);
+	EXPECT_EQ(transaction.commit(), Status::WRITTEN); // No second write.
+	EXPECT_EQ(Register(*transaction.getImage()), edited);
+}
+
+TEST_F(SM72445_ConfigTransaction, knownImageRequiresNoRead) {
+	EXPECT_CALL(i2c, read(_, _)).Times(0);
+	EXPECT_CALL(i2c, write(_, Eq(MemoryAddress::REG3), Eq(edited)))
+		.WillOnce(Return(edited));
+
+	auto transaction = sm72445.beginConfigTransaction(Reg3(initial));
+	transaction.edit().setPanelModeOverride(PanelMode::USE_H_BRIDGE);
+
+	EXPECT_EQ(transaction.commit(), Status::WRITTEN);
+}
+
+TEST_F(SM72445_ConfigTransaction, unchangedImageIsNotWritten) {
+	EXPECT_CALL(i2c, read(_, _)).Times(0);
+	EXPECT_CALL(i2c, write(_, _, _)).Times(0);
+
+	auto transaction = sm72445.beginConfigTransaction(Reg3(edited));
+	transaction.edit().setPanelModeOverride(PanelMode::USE_H_BRIDGE);
+
+	EXPECT_EQ(transaction.commit(), Status::UNCHANGED);
+	EXPECT_EQ(transaction.verify(), Status::UNCHANGED);
+}
+
+TEST_F(SM72445_ConfigTransaction, verifyReadsBackWrittenImage) {
+	EXPECT_CALL(i2c, write(_, Eq(MemoryAddress::REG3), _)).WillOnce(Return(edited));
+	EXPECT_CALL(i2c, read(_, Eq(MemoryAddress::REG3))).WillOnce(Return(edited));
+
+	auto transaction = sm72445.beginConfigTransaction(Reg3(initial));
+	transaction.edit().setPanelModeOverride(PanelMode::USE_H_BRIDGE);
+
+	EXPECT_EQ(transaction.verify(), Status::PENDING); // Nothing to verify yet.
+	transaction.commit();
+	EXPECT_EQ(transaction.verify(), Status::VERIFIED);
+	EXPECT_EQ(transaction.verify(), Status::VERIFIED); // No second read.
+}
+
+TEST_F(SM72445_ConfigTransaction, verifyReportsMismatchedReadback) {
+	EXPECT_CALL(i2c, write(_, Eq(MemoryAddress::REG3), _)).WillOnce(Return(edited));
+	EXPECT_CALL(i2c, read(_, Eq(MemoryAddress::REG3))).WillOnce(Return(initial));
+
+	auto transaction = sm72445.beginConfigTransaction(Reg3(initial));
+	transaction.edit().setPanelModeOverride(PanelMode::USE_H_BRIDGE);
+	transaction.commit();
+
+	EXPECT_EQ(transaction.verify(), Status::MISMATCH);
+	EXPECT_EQ(Register(*transaction.getImage()), initial);
+}
+
+TEST_F(SM72445_ConfigTransaction, failedReadIsNeverWritten) {
+	EXPECT_CALL(i2c, read(_, Eq(MemoryAddress::REG3))).WillOnce(Return(nullopt));
+	EXPECT_CALL(i2c, write(_, _, _)).Times(0);
+
+	auto transaction = sm72445.beginConfigTransaction();
+	transaction.edit().setPanelModeOverride(PanelMode::USE_H_BRIDGE);
+
+	EXPECT_EQ(transaction.commit(), Status::FAILED);
+	EXPECT_EQ(transaction.getImage(), nullopt);
+}
+
+TEST_F(SM72445_ConfigTransaction, failedWriteForgetsImage) {
+	disableI2C();
+
+	auto transaction = sm72445.beginConfigTransaction(Reg3(initial));
+	transaction.edit().setPanelModeOverride(PanelMode::USE_H_BRIDGE);
+
+	EXPECT_EQ(transaction.commit(), Status::FAILED);
+	EXPECT_EQ(transaction.verify(), Status::FAILED);
+	EXPECT_EQ(transaction.getImage(), nullopt);
+}
@@ -0,0 +1,172 @@
+/**
+ ******************************************************************************
+ * @file			: SM72445_ControlLoop.test.cpp
+ * @brief			: Tests for the fixed-period control loop executor.
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "SM72445_X.test.hpp"
+
+#include <atomic>
+#include <thread>
+
+#include "SM72445_ControlLoop.hpp"
+
+using ::testing::_;
+using ::testing::Eq;
+using ::testing::Return;
+
+using MemoryAddress = SM72445::MemoryAddress;
+using Cycle			= ControlLoop::Cycle;
+
+static constexpr uint64_t MILLISECOND = 1'000'000u;
+
+/**
+ * @brief A clock which advances only when slept on or when work is simulated, so that
+ * loop timing is exact.
+ */
+class VirtualClock : public ControlLoop::Clock {
+	std::atomic<uint64_t> time{1'000u * MILLISECOND};
+
+public:
+	virtual uint64_t now(void) override final { return this->time; }
+
+	virtual void sleepUntil(uint64_t deadline) override final {
+		if (deadline > this->time) this->time = deadline;
+	}
+
+	void work(uint64_t duration) { this->time += duration; }
+};
+
+class SM72445_ControlLoop : public SM72445_X_Test {
+public:
+	ControlLoop::Devices devices{&sm72445};
+};
+
+TEST_F(SM72445_ControlLoop, runsCallbackOncePerCycleAgainstDevices) {
+	EXPECT_CALL(i2c, read(_, Eq(MemoryAddress::REG1)))
+		.Times(5)
+		.WillRepeatedly(Return(0x0ull));
+
+	uint64_t   expectedIndex = 0u;
+	const auto poll			 = [&](Cycle &cycle) {
+		EXPECT_EQ(cycle.getIndex(), expectedIndex++);
+		for (auto device : cycle.getDevices()) device->getElectricalMeasurements();
+	};
+	ControlLoop loop{devices, MILLISECOND, poll};
+
+	EXPECT_EQ(loop.run(5u), 5u);
+
+	const auto stats = loop.getStats();
+	EXPECT_EQ(stats.cycles, 5u);
+	EXPECT_LE(stats.getJitterQuantile(0.5f), stats.getJitterQuantile(1.0f));
+	EXPECT_LE(stats.maxExecution, stats.getExecutionQuantile(1.0f));
+}
+
+TEST_F(SM72445_ControlLoop, deadlinesAreAbsoluteSoCallbackTimeDoesNotAccumulate) {
+	const uint64_t period = 4u * MILLISECOND;
+	VirtualClock   clock{};
+
+	uint64_t   first = 0u;
+	const auto work	 = [&](Cycle &cycle) {
+		 if (cycle.getIndex() == 0u) first = cycle.getDeadline();
+		 EXPECT_EQ(cycle.getDeadline(), first + cycle.getIndex() * period);
+		 EXPECT_EQ(cycle.getJitter(), 0u);
+		 clock.work(2u * MILLISECOND);
+	};
+	ControlLoop loop{devices, period, work, 0u, clock};
+
+	const uint64_t start = clock.now();
+	loop.run(10u);
+	const uint64_t elapsed = clock.now() - start;
+
+	// Relative sleeping would take 9 * (4 + 2) ms before the last cycle.
+	EXPECT_EQ(elapsed, 9u * period + 2u * MILLISECOND);
+
+	const auto stats = loop.getStats();
+	EXPECT_EQ(stats.cycles, 10u);
+	EXPECT_EQ(stats.misses, 0u);
+	EXPECT_EQ(stats.maxExecution, 2u * MILLISECOND);
+}
+
+TEST_F(SM72445_ControlLoop, overrunIsCountedAsMissAndShedsNonCriticalWork) {
+	EXPECT_CALL(i2c, read(_, Eq(MemoryAddress::REG4))).WillOnce(Return(0x0ull));
+
+	VirtualClock clock{};
+	uint64_t	 first = 0u;
+
+	bool	   ran[2] = {false, false};
+	const auto work	  = [&](Cycle &cycle) {
+		  const uint64_t index = cycle.getIndex();
+		  if (index == 0u) {
+			  first = cycle.getDeadline();
+			  clock.work(5u * MILLISECOND);
+		  } else EXPECT_EQ(cycle.getDeadline(), first + 6u * MILLISECOND);
+
+		  ran[index] = cycle.runNonCritical([&] {
+			  cycle.getDevices()[0]->getOffsetRegister();
+		  });
+	};
+	ControlLoop loop{devices, 2u * MILLISECOND, work, 0u, clock};
+
+	loop.run(2u);
+
+	EXPECT_FALSE(ran[0]);
+	EXPECT_TRUE(ran[1]);
+
+	const auto stats = loop.getStats();
+	EXPECT_EQ(stats.misses, 1u);
+	EXPECT_EQ(stats.skipped, 2u); // The deadlines at 2 ms and 4 ms.
+	EXPECT_EQ(stats.shed, 1u);
+	EXPECT_EQ(stats.maxExecution, 5u * MILLISECOND);
+}
+
+TEST_F(SM72445_ControlLoop, stopBeforeRunIsNotLost) {
+	VirtualClock clock{};
+	ControlLoop	 loop{devices, MILLISECOND, [](Cycle &) {}, 0u, clock};
+
+	loop.stop();
+	EXPECT_EQ(loop.run(), 0u);
+
+	// The stop is consumed by the run it ended.
+	EXPECT_EQ(loop.run(3u), 3u);
+}
+
+TEST_F(SM72445_ControlLoop, statsMayBeReadAndResetWhileRunning) {
+	VirtualClock	  clock{};
+	std::atomic<bool> done{false};
+
+	ControlLoop loop{devices, MILLISECOND, [&](Cycle &cycle) {
+		clock.work(MILLISECOND / 2u);
+		if (cycle.getIndex() == 100'000u) done = true;
+	}, 0u, clock};
+
+	std::thread runner([&] { loop.run(); });
+
+	while (!done) {
+		const auto stats = loop.getStats();
+		EXPECT_LE(stats.getExecutionQuantile(1.0f), MILLISECOND);
+		loop.resetStats();
+	}
+	loop.stop();
+	runner.join();
+
+	loop.resetStats();
+	EXPECT_EQ(loop.getStats().cycles, 0u);
+	EXPECT_EQ(loop.getStats().getExecutionQuantile(1.0f), 0u);
+}
+
+TEST_F(SM72445_ControlLoop, stopEndsLoopAfterCurrentCycle) {
+	ControlLoop *self = nullptr;
+	ControlLoop	 loop{devices, MILLISECOND, [&](Cycle &cycle) {
+		if (cycle.getIndex() == 2u) self->stop();
+	}};
+	self = &loop;
+
+	EXPECT_EQ(loop.run(), 3u);
+	EXPECT_EQ(loop.getStats().cycles, 3u);
+
+	loop.resetStats();
+	EXPECT_EQ(loop.getStats().cycles, 0u);
+}
@@ -0,0 +1,162 @@
+/**
+ ******************************************************************************
+ * @file			: SM72445_Discovery.test.cpp
+ * @brief			: Tests for parallel device discovery.
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "SM72445_X.test.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+
+#include "SM72445_Discovery.hpp"
+
+using ::testing::_;
+using ::testing::Eq;
+using ::testing::Ne;
+using ::testing::Return;
+
+using Register		= SM72445::Register;
+using DeviceAddress = SM72445::DeviceAddress;
+using MemoryAddress = SM72445::MemoryAddress;
+
+using std::nullopt;
+
+class SM72445_Discovery : public SM72445_X_Test {
+public:
+	MockedI2C probe{};
+	MockedI2C i2cB{};
+
+	DeviceDiscovery discovery{{{&i2c, &probe}, {&i2cB}}};
+
+	/**
+	 * @brief Respond to REG0 probes only at the given address.
+	 */
+	static void respondAt(MockedI2C &i2c, DeviceAddress deviceAddress, Register reg0) {
+		EXPECT_CALL(i2c, read(Ne(deviceAddress), Eq(MemoryAddress::REG0)))
+			.Times(6)
+			.WillRepeatedly(Return(nullopt));
+		EXPECT_CALL(i2c, read(Eq(deviceAddress), Eq(MemoryAddress::REG0)))
+			.WillOnce(Return(reg0));
+	}
+};
+
+TEST_F(SM72445_Discovery, probesEveryAddressAndReadsImagesOfResponders) {
+	respondAt(probe, DeviceAddress::ADDR110, 0x60ull);
+	EXPECT_CALL(i2c, read(_, Eq(MemoryAddress::REG0))).Times(0);
+	EXPECT_CALL(i2c, read(Eq(DeviceAddress::ADDR110), Eq(MemoryAddress::REG3)))
+		.WillOnce(Return(0x63ull));
+	EXPECT_CALL(i2c, read(Eq(DeviceAddress::ADDR110), Eq(MemoryAddress::REG4)))
+		.WillOnce(Return(0x64ull));
+	EXPECT_CALL(i2c, read(Eq(DeviceAddress::ADDR110), Eq(MemoryAddress::REG5)))
+		.WillOnce(Return(0x65ull));
+
+	respondAt(i2cB, DeviceAddress::ADDR001, 0x10ull); // No probe, so i2cB is probed.
+	EXPECT_CALL(i2cB, read(Eq(DeviceAddress::ADDR001), Ne(MemoryAddress::REG0)))
+		.Times(3)
+		.WillRepeatedly(Return(0x1ull));
+
+	const auto table = discovery.discover();
+
+	ASSERT_EQ(table.size(), 2u);
+	EXPECT_EQ(table[0].bus, 0u);
+	EXPECT_EQ(table[0].deviceAddress, DeviceAddress::ADDR110);
+	EXPECT_EQ(table[0].reg0, 0x60ull);
+	EXPECT_EQ(table[0].reg3, 0x63ull);
+	EXPECT_EQ(table[0].reg4, 0x64ull);
+	EXPECT_EQ(table[0].reg5, 0x65ull);
+	EXPECT_TRUE(table[0].isComplete());
+
+	EXPECT_EQ(table[1].bus, 1u);
+	EXPECT_EQ(table[1].deviceAddress, DeviceAddress::ADDR001);
+	EXPECT_EQ(table[1].reg0, 0x10ull);
+}
+
+TEST_F(SM72445_Discovery, failedImageReadsLeaveDeviceIncomplete) {
+	respondAt(probe, DeviceAddress::ADDR001, 0x0ull);
+	EXPECT_CALL(i2c, read(_, Eq(MemoryAddress::REG3))).WillOnce(Return(0x0ull));
+	EXPECT_CALL(i2c, read(_, Eq(MemoryAddress::REG4))).WillOnce(Return(nullopt));
+	EXPECT_CALL(i2c, read(_, Eq(MemoryAddress::REG5))).WillOnce(Return(0x0ull));
+	EXPECT_CALL(i2cB, read(_, _)).Times(7).WillRepeatedly(Return(nullopt));
+
+	const auto table = discovery.discover();
+
+	ASSERT_EQ(table.size(), 1u);
+	EXPECT_EQ(table[0].reg4, nullopt);
+	EXPECT_FALSE(table[0].isComplete());
+}
+
+TEST_F(SM72445_Discovery, emptyBusesYieldEmptyTable) {
+	EXPECT_CALL(probe, read(_, _)).Times(7).WillRepeatedly(Return(nullopt));
+	EXPECT_CALL(i2cB, read(_, _)).Times(7).WillRepeatedly(Return(nullopt));
+	EXPECT_CALL(i2c, read(_, _)).Times(0);
+
+	EXPECT_TRUE(discovery.discover().empty());
+	EXPECT_TRUE(DeviceDiscovery{{}}.discover().empty());
+}
+
+TEST_F(SM72445_Discovery, throwingBusIsRethrownAfterAllBusesFinish) {
+	EXPECT_CALL(probe, read(_, _)).WillRepeatedly(Return(nullopt));
+	EXPECT_CALL(i2cB, read(_, _))
+		.WillOnce([](DeviceAddress, MemoryAddress) -> optional<Register> {
+			throw std::runtime_error("bus fault");
+		});
+
+	EXPECT_THROW(discovery.discover(), std::runtime_error);
+}
+
+/**
+ * @brief An I2C whose first probe blocks until every bus has a probe in flight, or
+ * timeout. No devices respond.
+ */
+class ProbeRendezvousI2C : public SM72445::I2C {
+	std::atomic<size_t> &inFlight;
+	const size_t		 buses;
+	bool				 waited = false;
+
+public:
+	bool met = false;
+
+	ProbeRendezvousI2C(std::atomic<size_t> &inFlight, size_t buses)
+		: inFlight{inFlight}, buses{buses} {}
+
+	virtual optional<Register> read(DeviceAddress, MemoryAddress) override final {
+		if (this->waited) return nullopt;
+		this->waited = true;
+
+		const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+
+		this->inFlight++;
+		while (this->inFlight.load() < this->buses) {
+			if (std::chrono::steady_clock::now() > deadline) return nullopt;
+			std::this_thread::yield();
+		}
+		this->met = true;
+		return nullopt;
+	}
+
+	virtual optional<Register> write(DeviceAddress, MemoryAddress, Register)
+		override final {
+		return nullopt;
+	}
+};
+
+TEST(SM72445_DiscoveryParallel, busesAreProbedConcurrently) {
+	constexpr size_t	BUSES = 4u;
+	std::atomic<size_t> inFlight{0u};
+
+	std::vector<std::unique_ptr<ProbeRendezvousI2C>> i2cs;
+	std::vector<DeviceDiscovery::Bus>				 buses;
+	for (size_t i = 0; i < BUSES; i++) {
+		i2cs.emplace_back(new ProbeRendezvousI2C{inFlight, BUSES});
+		buses.push_back({i2cs.back().get()});
+	}
+
+	EXPECT_TRUE(DeviceDiscovery{buses}.discover().empty());
+	for (const auto &i2c : i2cs) EXPECT_TRUE(i2c->met);
+}
@@ -139,3 +139,18 @@ TEST_F(SM72445_ElectricalMeasurements, getOutputVoltageReturnsNulloptIfI2CReadFa
 	disableI2C();
 	EXPECT_EQ(sm72445.getOutputVoltage(), nullopt);
 }
+
+TEST_F(SM72445_ElectricalMeasurements, convertElectricalMeasurementsMatchesRead) {
+	const SM72445::Reg1 reg1{Register(0x0123'4567'89AB'CDEFul)};
+
+	EXPECT_CALL(i2c, read).Times(0);
+	auto measurements = sm72445.convertElectricalMeasurements(reg1).value();
+	EXPECT_FLOAT_EQ(
+		measurements[static_cast<uint8_t>(ElectricalProperty::CURRENT_IN)],
+		4.838709f
+	);
+	EXPECT_FLOAT_EQ(
+		measurements[static_cast<uint8_t>(ElectricalProperty::VOLTAGE_OUT)],
+		4.046921f
+	);
+}
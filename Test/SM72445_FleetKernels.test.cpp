@@ -0,0 +1,188 @@
+/**
+ ******************************************************************************
+ * @file			: SM72445_FleetKernels.test.cpp
+ * @brief			: Tests for the vectorised fleet power, efficiency and ranking kernels
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "SM72445_X.test.hpp"
+
+#include <random>
+#include <vector>
+
+#include "SM72445_FleetKernels.hpp"
+
+using Reg1			 = SM72445::Reg1;
+using InstructionSet = FleetKernels::InstructionSet;
+using Ranking		 = FleetKernels::Ranking;
+using Outputs		 = FleetKernels::Outputs;
+
+/**
+ * @brief A synthetic fleet built directly as FleetState columns.
+ */
+class SyntheticFleet {
+public:
+	array<std::vector<uint16_t>, FleetState::PROPERTIES> counts;
+	array<std::vector<float>, FleetState::PROPERTIES>	 scales;
+	std::vector<uint8_t>								 status;
+
+	explicit SyntheticFleet(size_t size, uint32_t seed = 1u) {
+		std::mt19937							mt{seed};
+		std::uniform_int_distribution<uint16_t> count{0u, 0x3FFu};
+		std::uniform_real_distribution<float>	scale{0.001f, 0.1f};
+
+		for (size_t i = 0; i < FleetState::PROPERTIES; i++) {
+			for (size_t j = 0; j < size; j++) {
+				// Some dark panels, and ties from a small range of counts.
+				this->counts[i].push_back((j % 17u == 0u) ? 0u : count(mt) & 0x3F0u);
+				this->scales[i].push_back(scale(mt));
+			}
+		}
+		for (size_t j = 0; j < size; j++) {
+			const bool failed = (j % 13u == 0u);
+			this->status.push_back(failed ? FleetState::FAILED : FleetState::VALID);
+		}
+	}
+
+	FleetState::Columns getColumns(void) const {
+		FleetState::Columns columns{};
+		for (size_t i = 0; i < FleetState::PROPERTIES; i++) {
+			columns.counts[i] = this->counts[i].data();
+			columns.scales[i] = this->scales[i].data();
+		}
+		columns.status = this->status.data();
+		columns.size   = this->status.size();
+		return columns;
+	}
+};
+
+class SM72445_FleetKernels : public SM72445_X_Test {
+public:
+	const InstructionSet original = FleetKernels::getInstructionSet();
+
+	void TearDown(void) override { FleetKernels::setInstructionSet(original); }
+};
+
+TEST_F(SM72445_FleetKernels, computesPowerEfficiencyAndTotals) {
+	SM72445_X unity{i2c, SM72445::DeviceAddress::ADDR010, 1.0f, 1.0f, 1.0f, 1.0f};
+
+	FleetState fleet;
+	fleet.add(sm72445);
+	fleet.add(unity);
+	fleet.add(unity);
+	fleet.update(0u, Reg1(100u, 200u, 150u, 120u));
+	fleet.update(1u, Reg1(0u, 800u, 0u, 700u)); // No input current.
+
+	float powerIn[3], powerOut[3], efficiency[3];
+	const auto summary = FleetKernels::evaluate(fleet, {powerIn, powerOut, efficiency});
+
+	const auto measured = *sm72445.convertElectricalMeasurements(fleet.getCounts(0u));
+	EXPECT_FLOAT_EQ(powerIn[0], measured[0] * measured[1]);
+	EXPECT_FLOAT_EQ(powerOut[0], measured[2] * measured[3]);
+	EXPECT_FLOAT_EQ(efficiency[0], powerOut[0] / powerIn[0]);
+
+	EXPECT_FLOAT_EQ(efficiency[1], 0.0f);
+	EXPECT_FLOAT_EQ(powerIn[2], 0.0f); // Never polled.
+
+	EXPECT_EQ(summary.devices, 2u);
+	EXPECT_DOUBLE_EQ(summary.powerIn, powerIn[0] + powerIn[1]);
+	EXPECT_DOUBLE_EQ(summary.powerOut, powerOut[0] + powerOut[1]);
+	EXPECT_FLOAT_EQ(summary.getEfficiency(), efficiency[0]);
+}
+
+TEST_F(SM72445_FleetKernels, ranksBestAndWorstDevices) {
+	const SyntheticFleet fleet{100u};
+
+	std::vector<float> efficiency(100u);
+	Ranking			   top[5], bottom[5];
+	const Outputs	   outputs{nullptr, nullptr, efficiency.data(), top, bottom, 5u};
+
+	const auto summary = FleetKernels::evaluate(fleet.getColumns(), outputs);
+	ASSERT_EQ(summary.ranked, 5u);
+
+	for (size_t i = 0; i < 5u; i++) {
+		EXPECT_EQ(top[i].efficiency, efficiency[top[i].id]);
+		EXPECT_EQ(bottom[i].efficiency, efficiency[bottom[i].id]);
+		if (i == 0u) continue;
+		EXPECT_GE(top[i - 1u].efficiency, top[i].efficiency);
+		EXPECT_LE(bottom[i - 1u].efficiency, bottom[i].efficiency);
+	}
+
+	// Every other ranked device lies between the fifth best and fifth worst.
+	size_t ranked = 0u;
+	for (size_t id = 0; id < 100u; id++) {
+		if (!(fleet.status[id] & FleetState::VALID) || efficiency[id] <= 0.0f) continue;
+		ranked++;
+		EXPECT_LE(efficiency[id], top[0].efficiency);
+		EXPECT_GE(efficiency[id], bottom[0].efficiency);
+	}
+	EXPECT_GT(ranked, 10u);
+}
+
+TEST_F(SM72445_FleetKernels, fewerRankableDevicesThanK) {
+	SyntheticFleet fleet{3u};
+	for (auto &counts : fleet.counts) counts = {0x100u, 0x100u, 0x100u};
+	fleet.counts[static_cast<uint8_t>(SM72445::ElectricalProperty::CURRENT_IN)][1] = 0u;
+
+	Ranking	   top[8];
+	Outputs	   outputs{};
+	outputs.top		   = top;
+	outputs.k		   = 8u;
+	const auto summary = FleetKernels::evaluate(fleet.getColumns(), outputs);
+
+	// Device 0 has failed and device 1 has no input power.
+	EXPECT_EQ(summary.devices, 2u);
+	EXPECT_EQ(summary.ranked, 1u);
+	EXPECT_EQ(top[0].id, 2u);
+}
+
+TEST_F(SM72445_FleetKernels, instructionSetsAgreeWithScalar) {
+	const SyntheticFleet fleet{1003u, 7u}; // Not a multiple of any vector width.
+	const size_t		 k = 16u;
+
+	std::vector<float> expected[3], actual[3];
+	Ranking			   expectedRanks[2][k], actualRanks[2][k];
+	for (auto &values : expected) values.resize(1003u);
+	for (auto &values : actual) values.resize(1003u);
+
+	ASSERT_TRUE(FleetKernels::setInstructionSet(InstructionSet::SCALAR));
+	const auto reference = FleetKernels::evaluate(
+		fleet.getColumns(),
+		{expected[0].data(),
+		 expected[1].data(),
+		 expected[2].data(),
+		 expectedRanks[0],
+		 expectedRanks[1],
+		 k}
+	);
+
+	for (auto instructionSet : {InstructionSet::AVX2, InstructionSet::NEON}) {
+		if (!FleetKernels::setInstructionSet(instructionSet)) continue;
+
+		const auto summary = FleetKernels::evaluate(
+			fleet.getColumns(),
+			{actual[0].data(),
+			 actual[1].data(),
+			 actual[2].data(),
+			 actualRanks[0],
+			 actualRanks[1],
+			 k}
+		);
+
+		for (size_t i = 0; i < 3u; i++) EXPECT_EQ(actual[i], expected[i]);
+		for (size_t i = 0; i < k; i++) {
+			EXPECT_EQ(actualRanks[0][i].id, expectedRanks[0][i].id);
+			EXPECT_EQ(actualRanks[1][i].id, expectedRanks[1][i].id);
+		}
+		EXPECT_EQ(summary.devices, reference.devices);
+		EXPECT_EQ(summary.ranked, reference.ranked);
+		EXPECT_NEAR(summary.powerIn, reference.powerIn, reference.powerIn * 1e-9);
+		EXPECT_NEAR(summary.powerOut, reference.powerOut, reference.powerOut * 1e-9);
+	}
+
+	EXPECT_FALSE(
+		FleetKernels::isSupported(InstructionSet::AVX2) &&
+		FleetKernels::isSupported(InstructionSet::NEON)
+	);
+}
@@ -0,0 +1,164 @@
+/**
+ ******************************************************************************
+ * @file			: SM72445_FleetState.test.cpp
+ * @brief			: Tests for the structure-of-arrays fleet state store.
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "SM72445_X.test.hpp"
+
+#include "SM72445_FleetState.hpp"
+
+using ::testing::_;
+using ::testing::Eq;
+using ::testing::Return;
+
+using Register			 = SM72445::Register;
+using Reg1				 = SM72445::Reg1;
+using MemoryAddress		 = SM72445::MemoryAddress;
+using ElectricalProperty = SM72445::ElectricalProperty;
+
+using std::nullopt;
+
+class SM72445_FleetState : public SM72445_X_Test {
+public:
+	SM72445_X unity{i2c, SM72445::DeviceAddress::ADDR010, 1.0f, 1.0f, 1.0f, 1.0f};
+
+	const Reg1 sample{100u, 200u, 300u, 400u};
+};
+
+TEST_F(SM72445_FleetState, devicesHaveDenseIds) {
+	FleetState fleet;
+
+	EXPECT_EQ(fleet.add(sm72445), 0u);
+	EXPECT_EQ(fleet.add(unity), 1u);
+	EXPECT_EQ(fleet.size(), 2u);
+	EXPECT_EQ(fleet.getStatus(0u), 0u); // Not yet polled.
+}
+
+TEST_F(SM72445_FleetState, conversionMatchesDevice) {
+	FleetState fleet;
+	fleet.add(sm72445);
+	fleet.add(unity);
+
+	const optional<Reg1> samples[] = {sample, sample};
+	fleet.update(0u, samples, 2u);
+
+	const array properties = {
+		ElectricalProperty::CURRENT_IN,
+		ElectricalProperty::VOLTAGE_OUT,
+	};
+	for (auto property : properties) {
+		float out[2];
+		fleet.convert(property, out);
+
+		const uint8_t index = static_cast<uint8_t>(property);
+		EXPECT_FLOAT_EQ(out[0], (*sm72445.convertElectricalMeasurements(sample))[index]);
+		EXPECT_FLOAT_EQ(out[1], (*unity.convertElectricalMeasurements(sample))[index]);
+	}
+}
+
+TEST_F(SM72445_FleetState, pollStoresCountsAndStatus) {
+	EXPECT_CALL(i2c, read(_, Eq(MemoryAddress::REG1)))
+		.WillOnce(Return(Register(sample)))
+		.WillOnce(Return(nullopt));
+
+	FleetState fleet;
+	fleet.add(sm72445);
+	fleet.add(unity);
+
+	EXPECT_EQ(fleet.poll(0u, 2u), 1u);
+
+	EXPECT_EQ(Register(fleet.getCounts(0u)), Register(sample));
+	EXPECT_EQ(fleet.getStatus(0u), FleetState::VALID);
+	EXPECT_EQ(fleet.getStatus(1u), FleetState::FAILED);
+}
+
+TEST_F(SM72445_FleetState, replacedCalibrationRefreshesScales) {
+	EXPECT_CALL(i2c, read(_, Eq(MemoryAddress::REG1))).WillRepeatedly(Return(Register(sample)));
+
+	FleetState fleet;
+	fleet.add(unity);
+	fleet.poll(0u, 1u);
+
+	const SM72445_X::Calibration doubled{2.0f, 2.0f, 2.0f, 2.0f};
+	unity.setCalibration(&doubled);
+
+	// Samples stored directly keep the old scales until refreshed.
+	fleet.update(0u, sample);
+	float before;
+	fleet.convert(ElectricalProperty::CURRENT_IN, &before);
+
+	fleet.updateScales(0u);
+	float after;
+	fleet.convert(ElectricalProperty::CURRENT_IN, &after);
+	EXPECT_NE(after, before);
+	EXPECT_FLOAT_EQ(after, (*unity.convertElectricalMeasurements(sample))[0]);
+
+	// poll() refreshes by itself.
+	unity.setCalibration(nullptr);
+	fleet.poll(0u, 1u);
+	fleet.convert(ElectricalProperty::CURRENT_IN, &after);
+	EXPECT_FLOAT_EQ(after, before);
+}
+
+TEST_F(SM72445_FleetState, calibrationReplacedAtTheSameAddressRefreshesScales) {
+	EXPECT_CALL(i2c, read(_, Eq(MemoryAddress::REG1))).WillRepeatedly(Return(Register(sample)));
+
+	FleetState fleet;
+	fleet.add(unity);
+
+	SM72445_X::Calibration block = unity.getCalibration();
+	unity.setCalibration(&block);
+	fleet.poll(0u, 1u);
+	float before;
+	fleet.convert(ElectricalProperty::CURRENT_IN, &before);
+
+	// As if the block were freed and its replacement allocated in its place.
+	unity.setCalibration(nullptr);
+	block = SM72445_X::Calibration{2.0f, 2.0f, 2.0f, 2.0f};
+	unity.setCalibration(&block);
+
+	fleet.poll(0u, 1u);
+	float after;
+	fleet.convert(ElectricalProperty::CURRENT_IN, &after);
+	EXPECT_NE(after, before);
+	EXPECT_FLOAT_EQ(after, (*unity.convertElectricalMeasurements(sample))[0]);
+
+	unity.setCalibration(nullptr);
+}
+
+TEST_F(SM72445_FleetState, failedUpdateKeepsLastCounts) {
+	FleetState fleet;
+	fleet.add(sm72445);
+
+	fleet.update(0u, sample);
+	fleet.update(0u, nullopt);
+
+	EXPECT_EQ(Register(fleet.getCounts(0u)), Register(sample));
+	EXPECT_EQ(fleet.getStatus(0u), FleetState::VALID | FleetState::FAILED);
+
+	fleet.update(0u, sample); // Recovery clears the failure.
+	EXPECT_EQ(fleet.getStatus(0u), FleetState::VALID);
+}
+
+TEST_F(SM72445_FleetState, rangesAreClippedToFleet) {
+	SM72445_X zeroGain{i2c, SM72445::DeviceAddress::ADDR011, 0.0f, 1.0f, 1.0f, 1.0f};
+
+	FleetState fleet;
+	fleet.add(sm72445);
+	fleet.add(zeroGain);
+
+	const optional<Reg1> samples[] = {sample, sample, sample};
+	fleet.update(1u, samples, 3u); // Only device 1 exists in the range.
+	EXPECT_EQ(fleet.getStatus(0u), 0u);
+	EXPECT_EQ(fleet.getStatus(1u), FleetState::VALID);
+
+	float out[2] = {-1.0f, -1.0f};
+	fleet.convert(ElectricalProperty::VOLTAGE_IN, out, 1u, 5u);
+	EXPECT_FLOAT_EQ(out[0], 0.0f); // Unconvertible devices convert to zero.
+	EXPECT_FLOAT_EQ(out[1], -1.0f);
+
+	EXPECT_EQ(fleet.poll(2u, 1u), 0u);
+}
@@ -0,0 +1,106 @@
+/**
+ ******************************************************************************
+ * @file			: SM72445_Flyweight.test.cpp
+ * @brief			: Tests for device handles and interned calibration profiles.
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "SM72445_X.test.hpp"
+
+#include "SM72445_Flyweight.hpp"
+
+using ::testing::_;
+using ::testing::Eq;
+using ::testing::Return;
+
+using Register		= SM72445::Register;
+using Reg1			= SM72445::Reg1;
+using DeviceAddress = SM72445::DeviceAddress;
+using MemoryAddress = SM72445::MemoryAddress;
+using Profile		= DeviceDirectory::Profile;
+
+using std::nullopt;
+
+static_assert(sizeof(DeviceHandle) == 4u, "DeviceHandle has grown");
+
+class SM72445_Flyweight : public SM72445_X_Test {
+public:
+	MockedI2C i2cB{};
+
+	DeviceDirectory directory{};
+
+	const Profile revA{.5f, .5f, .5f, .5f};
+	const Profile revB{.5f, .4f, .3f, .2f, 3.3f};
+
+	void SetUp(void) override {
+		directory.addBus(i2c);
+		directory.addBus(i2cB);
+	}
+};
+
+TEST_F(SM72445_Flyweight, equalProfilesAreInternedOnce) {
+	const auto a1 = directory.makeHandle(0u, DeviceAddress::ADDR001, revA);
+	const auto a2 = directory.makeHandle(1u, DeviceAddress::ADDR001, Profile{revA});
+	const auto b1 = directory.makeHandle(0u, DeviceAddress::ADDR010, revB);
+
+	ASSERT_TRUE(a1 && a2 && b1);
+	EXPECT_EQ(a1->profile, a2->profile);
+	EXPECT_NE(a1->profile, b1->profile);
+	EXPECT_EQ(directory.getProfileCount(), 2u);
+	EXPECT_EQ(*directory.getProfile(*b1), revB);
+}
+
+TEST_F(SM72445_Flyweight, resolvedDeviceUsesHandlesBusAndCalibration) {
+	const Reg1 reg1(100u, 200u, 300u, 400u);
+	EXPECT_CALL(i2c, read(_, _)).Times(0);
+	EXPECT_CALL(i2cB, read(Eq(DeviceAddress::ADDR011), Eq(MemoryAddress::REG1)))
+		.WillOnce(Return(Register(reg1)));
+
+	const auto handle = directory.makeHandle(1u, DeviceAddress::ADDR011, revB);
+	ASSERT_TRUE(handle);
+
+	const auto		device	 = directory.resolve(*handle);
+	const SM72445_X expected = {i2cB, DeviceAddress::ADDR011, .5f, .4f, .3f, .2f, 3.3f};
+
+	ASSERT_TRUE(device);
+	EXPECT_EQ(device->getDeviceAddress(), DeviceAddress::ADDR011);
+	EXPECT_EQ(
+		device->getElectricalMeasurements(),
+		expected.convertElectricalMeasurements(reg1)
+	);
+}
+
+TEST_F(SM72445_Flyweight, resolvedDevicesShareTheInternedProfile) {
+	const auto handle = directory.makeHandle(0u, DeviceAddress::ADDR001, revA);
+	ASSERT_TRUE(handle);
+
+	// Interning further profiles does not move those already interned.
+	for (float gain = 1.f; gain < 64.f; gain++) {
+		directory.makeHandle(0u, DeviceAddress::ADDR001, Profile{gain, gain, gain, gain});
+	}
+
+	const auto first  = directory.resolve(*handle);
+	const auto second = directory.resolve(*handle);
+
+	ASSERT_TRUE(first && second);
+	EXPECT_EQ(&first->getCalibration(), directory.getProfile(*handle));
+	EXPECT_EQ(&second->getCalibration(), directory.getProfile(*handle));
+}
+
+TEST_F(SM72445_Flyweight, invalidHandlesDoNotResolve) {
+	ASSERT_TRUE(directory.makeHandle(0u, DeviceAddress::ADDR001, revA));
+
+	const DeviceHandle badProfile{0u, DeviceAddress::ADDR001, 1u};
+	const DeviceHandle badBus{2u, DeviceAddress::ADDR001, 0u};
+
+	EXPECT_EQ(directory.getProfile(badProfile), nullptr);
+	EXPECT_EQ(directory.getProfile(badBus), nullptr);
+	EXPECT_FALSE(directory.resolve(badProfile).has_value());
+	EXPECT_FALSE(directory.resolve(badBus).has_value());
+}
+
+TEST_F(SM72445_Flyweight, handlesRequireAnExistingBus) {
+	EXPECT_EQ(directory.makeHandle(2u, DeviceAddress::ADDR001, revA), nullopt);
+	EXPECT_EQ(directory.getProfileCount(), 0u);
+}
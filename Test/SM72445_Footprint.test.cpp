@@ -0,0 +1,302 @@
+/**
+ ******************************************************************************
+ * @file			: SM72445_Footprint.test.cpp
+ * @brief			: Allocation-free and object size guarantees of the driver.
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "SM72445.test.hpp"
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <type_traits>
+
+#include "SM72445_AdaptivePoll.hpp"
+#include "SM72445_Transport.hpp"
+#include "SM72445_WriteCoalescer.hpp"
+
+using Register		= SM72445::Register;
+using DeviceAddress = SM72445::DeviceAddress;
+using MemoryAddress = SM72445::MemoryAddress;
+using PanelMode		= SM72445_X::Config::PanelMode;
+
+using ElectricalProperty = SM72445::ElectricalProperty;
+using CurrentThreshold	 = SM72445::CurrentThreshold;
+
+/* Allocation Tracking ----------------------------------------------------------------*/
+
+// Global operator new is replaced for the whole test executable, but only counts (and
+// refuses) allocations made on a thread while an AllocationGuard is armed on it.
+static thread_local bool   allocationGuardArmed = false;
+static std::atomic<size_t> guardedAllocations{0u};
+
+static void *allocate(std::size_t size, std::size_t alignment) {
+	if (allocationGuardArmed) {
+		guardedAllocations++;
+		throw std::bad_alloc(); // Fail loudly; no heap exists on the target.
+	}
+
+	if (size == 0u) size = 1u;
+
+	void *memory;
+	if (alignment > alignof(std::max_align_t)) {
+		const size_t rounded = (size + alignment - 1u) & ~(alignment - 1u);
+		memory				 = std::aligned_alloc(alignment, rounded);
+	} else memory = std::malloc(size);
+
+	if (!memory) throw std::bad_alloc();
+	return memory;
+}
+
+void *operator new(std::size_t size) { return allocate(size, 0u); }
+void *operator new[](std::size_t size) { return allocate(size, 0u); }
+void *operator new(std::size_t size, std::align_val_t alignment) {
+	return allocate(size, static_cast<std::size_t>(alignment));
+}
+void *operator new[](std::size_t size, std::align_val_t alignment) {
+	return allocate(size, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void *memory) noexcept { std::free(memory); }
+void operator delete[](void *memory) noexcept { std::free(memory); }
+void operator delete(void *memory, std::size_t) noexcept { std::free(memory); }
+void operator delete[](void *memory, std::size_t) noexcept { std::free(memory); }
+void operator delete(void *memory, std::align_val_t) noexcept { std::free(memory); }
+void operator delete[](void *memory, std::align_val_t) noexcept { std::free(memory); }
+void operator delete(void *memory, std::size_t, std::align_val_t) noexcept {
+	std::free(memory);
+}
+void operator delete[](void *memory, std::size_t, std::align_val_t) noexcept {
+	std::free(memory);
+}
+
+/**
+ * @brief Forbids heap allocation on the calling thread for its lifetime.
+ */
+class AllocationGuard {
+	const size_t start;
+
+public:
+	AllocationGuard() : start{guardedAllocations.load()} { allocationGuardArmed = true; }
+	~AllocationGuard() { allocationGuardArmed = false; }
+
+	size_t getAllocations(void) const { return guardedAllocations.load() - this->start; }
+};
+
+/**
+ * @brief A non-allocating I2C serving register images from a fixed table. Mocks are not
+ * used inside guarded regions, as the mocking framework itself allocates.
+ */
+class StaticI2C : public SM72445::I2C {
+public:
+	array<Register, 8> registers{}; // Indexed by MemoryAddress - REG0.
+
+	virtual optional<Register> read(
+		DeviceAddress deviceAddress, //
+		MemoryAddress memoryAddress
+	) override final {
+		(void)deviceAddress;
+		return this->registers[static_cast<uint8_t>(memoryAddress) & 0x7u];
+	}
+
+	virtual optional<Register> write(
+		DeviceAddress deviceAddress,
+		MemoryAddress memoryAddress,
+		Register	  data
+	) override final {
+		(void)deviceAddress;
+		this->registers[static_cast<uint8_t>(memoryAddress) & 0x7u] = data;
+		return data;
+	}
+};
+
+class SM72445_Footprint : public ::testing::Test {
+public:
+	StaticI2C i2c{};
+	SM72445_X sm72445{i2c, DeviceAddress::ADDR001, .5f, .5f, .5f, .5f};
+
+	void SetUp() override {
+		i2c.registers[static_cast<uint8_t>(MemoryAddress::REG1) & 0x7u] =
+			0x0123'4567'89AB'CDEFull;
+		i2c.registers[static_cast<uint8_t>(MemoryAddress::REG3) & 0x7u] =
+			Register(SM72445::Reg3());
+	}
+};
+
+/* Allocation Tests -------------------------------------------------------------------*/
+
+static void *volatile escapedAllocation = nullptr; // Prevents new/delete elision.
+
+TEST_F(SM72445_Footprint, guardDetectsAllocation) {
+	AllocationGuard guard{};
+
+	try {
+		escapedAllocation = new int(0);
+	} catch (const std::bad_alloc &) {}
+
+	EXPECT_EQ(guard.getAllocations(), 1u);
+	EXPECT_EQ(escapedAllocation, nullptr);
+}
+
+TEST_F(SM72445_Footprint, registerAccessDoesNotAllocate) {
+	AllocationGuard guard{};
+
+	sm72445.getAnalogueChannelRegister();
+	sm72445.getElectricalMeasurementsRegister();
+	sm72445.getConfigRegister();
+	sm72445.getOffsetRegister();
+	sm72445.getThresholdRegister();
+
+	EXPECT_EQ(guard.getAllocations(), 0u);
+}
+
+TEST_F(SM72445_Footprint, conversionsDoNotAllocate) {
+	AllocationGuard guard{};
+
+	sm72445.getElectricalMeasurements();
+	sm72445.getInputCurrent();
+	sm72445.getOutputVoltage();
+	sm72445.getAnalogueChannelVoltages();
+	sm72445.getOffsets();
+	sm72445.getCurrentThresholds();
+	sm72445.convertAdcResultToPinVoltage(512u, 10u);
+
+	EXPECT_EQ(guard.getAllocations(), 0u);
+}
+
+TEST_F(SM72445_Footprint, configurationDoesNotAllocate) {
+	AllocationGuard guard{};
+
+	sm72445.getConfig();
+	sm72445.setConfig(sm72445.getConfigBuilder(true)
+						  .setPanelModeOverride(PanelMode::USE_H_BRIDGE)
+						  .setMaxOutputCurrentOverride(2.0f)
+						  .setMaxOutputVoltageOverride(12.0f)
+						  .build());
+
+	sm72445.getOffsetBuilder(true)
+		.setOffset(ElectricalProperty::CURRENT_IN, 0.1f)
+		.commit();
+	sm72445.getThresholdBuilder(true)
+		.setCurrentThreshold(CurrentThreshold::CURRENT_IN_LOW, 1.0f)
+		.commit();
+
+	auto transaction = sm72445.beginConfigTransaction();
+	transaction.edit().setBbReset(true);
+	transaction.commit();
+	transaction.verify();
+
+	EXPECT_EQ(guard.getAllocations(), 0u);
+}
+
+TEST_F(SM72445_Footprint, adaptivePollingDoesNotAllocate) {
+	AdaptivePollController controller{sm72445, 10u, 1'000u};
+
+	AllocationGuard guard{};
+
+	controller.loadThresholds();
+	for (uint32_t now = 0u; now < 10'000u; now += 10u) controller.poll(now);
+
+	EXPECT_EQ(guard.getAllocations(), 0u);
+}
+
+TEST_F(SM72445_Footprint, writeCoalescingDoesNotAllocate) {
+	ConfigWriteCoalescer coalescer{sm72445, 8u};
+
+	AllocationGuard guard{};
+
+	coalescer.load();
+	for (float current = 0.0f; current < 5.0f; current += 0.1f) {
+		coalescer.submit(
+			sm72445.getConfigBuilder().setMaxOutputCurrentOverride(current).build()
+		);
+		coalescer.flush();
+	}
+
+	EXPECT_EQ(guard.getAllocations(), 0u);
+}
+
+/* Footprint --------------------------------------------------------------------------*/
+
+// Register objects are exactly one Register word and may be copied with memcpy.
+template <typename Reg>
+static constexpr bool isPackedRegister(void) {
+	return sizeof(Reg) == sizeof(Register) && std::is_trivially_copyable<Reg>::value
+		&& std::is_copy_assignable<Reg>::value;
+}
+
+static_assert(isPackedRegister<SM72445::Reg0>(), "Reg0 is not a packed register");
+static_assert(isPackedRegister<SM72445::Reg1>(), "Reg1 is not a packed register");
+static_assert(isPackedRegister<SM72445::Reg3>(), "Reg3 is not a packed register");
+static_assert(isPackedRegister<SM72445::Reg4>(), "Reg4 is not a packed register");
+static_assert(isPackedRegister<SM72445::Reg5>(), "Reg5 is not a packed register");
+
+static_assert(
+	std::is_trivially_copyable<SM72445_X::Config>::value
+		&& std::is_copy_assignable<SM72445_X::Config>::value,
+	"Config is not a plain value"
+);
+
+// Upper bounds on object sizes. A change that fails these grows every deployed instance.
+static_assert(sizeof(SM72445) <= 2u * sizeof(void *), "SM72445 has grown");
+static_assert(
+	sizeof(SM72445_X) <= sizeof(SM72445) + sizeof(SM72445_X::Calibration)
+							 + sizeof(void *) + (alignof(void *) - alignof(float)),
+	"SM72445_X has grown"
+); // The constructor's calibration, and the published calibration pointer with padding.
+static_assert(sizeof(SM72445_X::Config) <= 24u, "Config has grown");
+static_assert(
+	sizeof(SM72445_X::ConfigBuilder) <= sizeof(void *) + sizeof(Register),
+	"ConfigBuilder has grown"
+);
+static_assert(
+	sizeof(SM72445_X::ConfigTransaction)
+		<= sizeof(void *) + sizeof(SM72445_X::ConfigBuilder) + 3u * sizeof(Register),
+	"ConfigTransaction has grown"
+);
+// Four precomputed inverse gains and a dirty mask per builder.
+static_assert(
+	sizeof(SM72445_X::OffsetBuilder) <= sizeof(void *) + sizeof(Register) + 24u,
+	"OffsetBuilder has grown"
+);
+static_assert(
+	sizeof(SM72445_X::ThresholdBuilder) <= sizeof(void *) + sizeof(Register) + 24u,
+	"ThresholdBuilder has grown"
+);
+// The vtable and transport pointers, and the frame buffer for single transfers.
+static_assert(
+	sizeof(FramedI2C) <= 2u * sizeof(void *) + FramedI2C::FRAME_SIZE,
+	"FramedI2C has grown"
+);
+
+TEST(SM72445_FootprintReport, reportsObjectSizes) {
+	const struct {
+		const char *name;
+		size_t		size;
+	} sizes[] = {
+		{"SM72445", sizeof(SM72445)},
+		{"SM72445_X", sizeof(SM72445_X)},
+		{"SM72445_X::Config", sizeof(SM72445_X::Config)},
+		{"SM72445_X::ConfigBuilder", sizeof(SM72445_X::ConfigBuilder)},
+		{"SM72445_X::ConfigTransaction", sizeof(SM72445_X::ConfigTransaction)},
+		{"SM72445_X::OffsetBuilder", sizeof(SM72445_X::OffsetBuilder)},
+		{"SM72445_X::ThresholdBuilder", sizeof(SM72445_X::ThresholdBuilder)},
+		{"SM72445::Reg0", sizeof(SM72445::Reg0)},
+		{"SM72445::Reg1", sizeof(SM72445::Reg1)},
+		{"SM72445::Reg3", sizeof(SM72445::Reg3)},
+		{"SM72445::Reg4", sizeof(SM72445::Reg4)},
+		{"SM72445::Reg5", sizeof(SM72445::Reg5)},
+		{"AdaptivePollController", sizeof(AdaptivePollController)},
+		{"ConfigWriteCoalescer", sizeof(ConfigWriteCoalescer)},
+		{"FramedI2C", sizeof(FramedI2C)},
+	};
+
+	std::printf("%-30s %5s\n", "Type", "Bytes");
+	for (const auto &entry : sizes) {
+		std::printf("%-30s %5zu\n", entry.name, entry.size);
+		::testing::Test::RecordProperty(entry.name, std::to_string(entry.size));
+	}
+}
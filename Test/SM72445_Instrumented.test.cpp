@@ -0,0 +1,151 @@
+/**
+ ******************************************************************************
+ * @file			: SM72445_Instrumented.test.cpp
+ * @brief			: Tests for the instrumenting I2C decorator.
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "SM72445_X.test.hpp"
+
+#include <thread>
+#include <vector>
+
+#include "SM72445_Instrumented.hpp"
+
+using ::testing::_;
+using ::testing::Eq;
+using ::testing::Return;
+
+using DeviceAddress = SM72445::DeviceAddress;
+using MemoryAddress = SM72445::MemoryAddress;
+
+using std::nullopt;
+
+static uint64_t fakeNow		= 0u;
+static uint64_t fakeLatency = 0u;
+
+static uint64_t getFakeNanoseconds(void) {
+	const uint64_t now	= fakeNow;
+	fakeNow			   += fakeLatency;
+	return now;
+}
+
+class SM72445_Instrumented : public SM72445_X_Test {
+public:
+	InstrumentedI2C instrumented{i2c, getFakeNanoseconds};
+	SM72445_X		device{instrumented, DeviceAddress::ADDR011, .5f, .5f, .5f, .5f};
+
+	void SetUp() override {
+		fakeNow		= 0u;
+		fakeLatency = 0u;
+	}
+};
+
+TEST_F(SM72445_Instrumented, countsAreKeptPerDeviceAndRegister) {
+	EXPECT_CALL(i2c, read(Eq(DeviceAddress::ADDR011), Eq(MemoryAddress::REG1)))
+		.Times(3)
+		.WillRepeatedly(Return(0x1ull));
+	EXPECT_CALL(i2c, read(Eq(DeviceAddress::ADDR011), Eq(MemoryAddress::REG3)))
+		.WillOnce(Return(0x0ull));
+	EXPECT_CALL(i2c, write(Eq(DeviceAddress::ADDR011), Eq(MemoryAddress::REG3), _))
+		.WillOnce(Return(0x0ull));
+
+	for (int i = 0; i < 3; i++) device.getElectricalMeasurementsRegister();
+	device.setConfig(device.getConfigBuilder(true).build());
+
+	auto reg1 = instrumented.snapshot(DeviceAddress::ADDR011, MemoryAddress::REG1);
+	EXPECT_EQ(reg1.reads, 3u);
+	EXPECT_EQ(reg1.writes, 0u);
+	EXPECT_EQ(reg1.bytes, 3u * InstrumentedI2C::BYTES_PER_TRANSACTION);
+
+	auto reg3 = instrumented.snapshot(DeviceAddress::ADDR011, MemoryAddress::REG3);
+	EXPECT_EQ(reg3.reads, 1u);
+	EXPECT_EQ(reg3.writes, 1u);
+
+	auto other = instrumented.snapshot(DeviceAddress::ADDR001, MemoryAddress::REG1);
+	EXPECT_EQ(other.reads, 0u);
+	EXPECT_EQ(instrumented.snapshot().getCalls(), 5u);
+}
+
+TEST_F(SM72445_Instrumented, failuresAreCountedWithoutBytes) {
+	disableI2C();
+
+	device.getElectricalMeasurementsRegister();
+	device.setConfig(0x0ull);
+
+	auto stats = instrumented.snapshot();
+	EXPECT_EQ(stats.failures, 2u);
+	EXPECT_EQ(stats.bytes, 0u);
+}
+
+TEST_F(SM72445_Instrumented, snapshotByRegisterSumsAllDevices) {
+	EXPECT_CALL(i2c, read(_, Eq(MemoryAddress::REG5))).WillRepeatedly(Return(0x0ull));
+
+	instrumented.read(DeviceAddress::ADDR001, MemoryAddress::REG5);
+	instrumented.read(DeviceAddress::ADDR111, MemoryAddress::REG5);
+
+	EXPECT_EQ(instrumented.snapshot(MemoryAddress::REG5).reads, 2u);
+	EXPECT_EQ(instrumented.snapshot(MemoryAddress::REG1).reads, 0u);
+}
+
+TEST_F(SM72445_Instrumented, latencyIsRecordedInHistogram) {
+	EXPECT_CALL(i2c, read(_, _)).WillRepeatedly(Return(0x0ull));
+
+	fakeLatency = 100'000u;
+	for (int i = 0; i < 99; i++) {
+		instrumented.read(DeviceAddress::ADDR001, MemoryAddress::REG1);
+	}
+	fakeLatency = 10'000'000u;
+	instrumented.read(DeviceAddress::ADDR001, MemoryAddress::REG1);
+
+	auto stats = instrumented.snapshot(DeviceAddress::ADDR001, MemoryAddress::REG1);
+	EXPECT_EQ(stats.nanoseconds, 99u * 100'000u + 10'000'000u);
+
+	const uint64_t median = stats.getLatencyQuantile(0.5f);
+	EXPECT_GE(median, 100'000u);
+	EXPECT_LE(median, 125'000u);
+
+	const uint64_t maximum = stats.getLatencyQuantile(1.0f);
+	EXPECT_GE(maximum, 10'000'000u);
+	EXPECT_LE(maximum, 12'500'000u);
+}
+
+TEST_F(SM72445_Instrumented, bucketsAreContiguousAndBounded) {
+	EXPECT_EQ(InstrumentedI2C::getBucket(0u), 0u);
+	EXPECT_EQ(InstrumentedI2C::getBucket(UINT64_MAX), InstrumentedI2C::BUCKETS - 1u);
+
+	for (uint64_t value = 1u; value < (1ull << 20u); value = value * 9u / 8u + 1u) {
+		const size_t bucket = InstrumentedI2C::getBucket(value);
+		EXPECT_LE(value, InstrumentedI2C::getBucketUpperBound(bucket));
+		if (bucket == 0u) continue;
+		EXPECT_GT(value, InstrumentedI2C::getBucketUpperBound(bucket - 1u));
+	}
+}
+
+TEST_F(SM72445_Instrumented, resetZeroesAllCounters) {
+	EXPECT_CALL(i2c, read(_, _)).WillRepeatedly(Return(0x0ull));
+
+	instrumented.read(DeviceAddress::ADDR001, MemoryAddress::REG1);
+	instrumented.reset();
+
+	auto stats = instrumented.snapshot();
+	EXPECT_EQ(stats.getCalls(), 0u);
+	EXPECT_EQ(stats.getLatencyQuantile(0.5f), 0u);
+}
+
+TEST_F(SM72445_Instrumented, concurrentTransactionsAreAllCounted) {
+	EXPECT_CALL(i2c, read(_, _)).WillRepeatedly(Return(0x0ull));
+
+	std::vector<std::thread> threads;
+	for (int t = 0; t < 4; t++) {
+		threads.emplace_back([&] {
+			for (int i = 0; i < 10'000; i++) {
+				instrumented.read(DeviceAddress::ADDR001, MemoryAddress::REG1);
+			}
+		});
+	}
+	for (auto &thread : threads) thread.join();
+
+	EXPECT_EQ(instrumented.snapshot(MemoryAddress::REG1).reads, 40'000u);
+}
@@ -0,0 +1,93 @@
+/**
+ ******************************************************************************
+ * @file			: SM72445_LatestSample.test.cpp
+ * @brief			: Tests for the wait-free latest sample cell.
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "SM72445_X.test.hpp"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "SM72445_LatestSample.hpp"
+
+using ::testing::_;
+using ::testing::Eq;
+using ::testing::Return;
+
+using Register		= SM72445::Register;
+using MemoryAddress = SM72445::MemoryAddress;
+using Reg1			= SM72445::Reg1;
+
+using std::nullopt;
+
+class SM72445_LatestSample : public SM72445_X_Test {
+public:
+	LatestSample cell{};
+};
+
+TEST_F(SM72445_LatestSample, loadReturnsNulloptBeforeFirstSample) {
+	EXPECT_EQ(cell.getElectricalMeasurementsRegister(), nullopt);
+	EXPECT_FALSE(cell.load().has_value());
+}
+
+TEST_F(SM72445_LatestSample, updatePublishesSuccessfulReads) {
+	EXPECT_CALL(i2c, read(_, Eq(MemoryAddress::REG1)))
+		.WillOnce(Return(0x0123'4567'89AB'CDEFull))
+		.WillOnce(Return(nullopt));
+
+	ASSERT_TRUE(cell.update(sm72445).has_value());
+	EXPECT_EQ(cell.update(sm72445), nullopt);
+
+	auto sample = cell.load().value();
+	EXPECT_EQ(sample.count, 1u);
+	EXPECT_EQ(sample.reg1, Register(Reg1(Register(0x0123'4567'89AB'CDEFull))));
+
+	auto converted = sm72445.convertElectricalMeasurements(
+		cell.getElectricalMeasurementsRegister().value()
+	);
+	EXPECT_FLOAT_EQ(converted.value()[0], 4.838709f);
+}
+
+TEST_F(SM72445_LatestSample, storeReplacesPreviousSample) {
+	cell.store(Reg1{1u, 2u, 3u, 4u});
+	cell.store(Reg1{5u, 6u, 7u, 8u});
+
+	auto sample = cell.load().value();
+	EXPECT_EQ(sample.count, 2u);
+	EXPECT_EQ(sample.reg1, Register(Reg1(5u, 6u, 7u, 8u)));
+}
+
+TEST_F(SM72445_LatestSample, readersNeverObserveTornSamples) {
+	std::atomic<bool> done{false};
+
+	std::thread writer([&] {
+		for (uint16_t i = 0; i < 50'000u; i++) {
+			const uint16_t value = i & 0x3FFu;
+			cell.store(Reg1{value, value, value, value});
+		}
+		done = true;
+	});
+
+	std::vector<std::thread> readers;
+	std::atomic<uint64_t>	 torn{0u};
+	for (int r = 0; r < 3; r++) {
+		readers.emplace_back([&] {
+			while (!done) {
+				auto reg1 = cell.getElectricalMeasurementsRegister();
+				if (!reg1) continue;
+				if (reg1->iIn != reg1->vIn || reg1->iIn != reg1->iOut
+					|| reg1->iIn != reg1->vOut)
+					torn++;
+			}
+		});
+	}
+
+	writer.join();
+	for (auto &reader : readers) reader.join();
+
+	EXPECT_EQ(torn, 0u);
+}
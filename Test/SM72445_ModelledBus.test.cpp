@@ -0,0 +1,103 @@
+/**
+ ******************************************************************************
+ * @file			: SM72445_ModelledBus.test.cpp
+ * @brief			: Tests for the virtual-time I2C bus model.
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "SM72445_X.test.hpp"
+
+#include "SM72445_ModelledBus.hpp"
+
+using ::testing::_;
+using ::testing::Eq;
+using ::testing::Return;
+
+using DeviceAddress = SM72445::DeviceAddress;
+using MemoryAddress = SM72445::MemoryAddress;
+using ClockRate		= ModelledBusI2C::ClockRate;
+
+using std::nullopt;
+
+class SM72445_ModelledBus : public SM72445_X_Test {
+public:
+	ModelledBusI2C bus{i2c, ClockRate::STANDARD};
+	SM72445_X	   device{bus, DeviceAddress::ADDR001, .5f, .5f, .5f, .5f};
+};
+
+TEST_F(SM72445_ModelledBus, transactionsArePassedThrough) {
+	EXPECT_CALL(i2c, read(Eq(DeviceAddress::ADDR001), Eq(MemoryAddress::REG1)))
+		.WillOnce(Return(0x1234ull));
+	EXPECT_CALL(i2c, write(Eq(DeviceAddress::ADDR001), Eq(MemoryAddress::REG3), Eq(5ull)))
+		.WillOnce(Return(0x5ull));
+
+	EXPECT_EQ(bus.read(DeviceAddress::ADDR001, MemoryAddress::REG1), 0x1234ull);
+	EXPECT_EQ(bus.write(DeviceAddress::ADDR001, MemoryAddress::REG3, 0x5ull), 0x5ull);
+	EXPECT_EQ(bus.getTransactionCount(), 2u);
+}
+
+TEST_F(SM72445_ModelledBus, readTimeFollowsClockRate) {
+	EXPECT_CALL(i2c, read(_, _)).WillRepeatedly(Return(0x0ull));
+
+	device.getElectricalMeasurementsRegister();
+
+	// 102 clocks at 10 us each, then tBUF.
+	EXPECT_EQ(bus.getTime(), 102u * 10'000u + 4'700u);
+
+	ModelledBusI2C fast{i2c, ClockRate::FAST_PLUS};
+	fast.read(DeviceAddress::ADDR001, MemoryAddress::REG1);
+	EXPECT_EQ(fast.getTime(), 102u * 1'000u + 500u);
+}
+
+TEST_F(SM72445_ModelledBus, writesOmitRepeatedStart) {
+	EXPECT_CALL(i2c, write(_, _, _)).WillOnce(Return(0x0ull));
+
+	bus.write(DeviceAddress::ADDR001, MemoryAddress::REG3, 0x0ull);
+	EXPECT_EQ(bus.getTime(), bus.getTransactionTime(ModelledBusI2C::WRITE_CLOCKS));
+	EXPECT_LT(ModelledBusI2C::WRITE_CLOCKS, ModelledBusI2C::READ_CLOCKS);
+}
+
+TEST_F(SM72445_ModelledBus, failedTransactionsCostOnlyTheAddressPhase) {
+	disableI2C();
+
+	device.getElectricalMeasurementsRegister();
+	EXPECT_EQ(bus.getTime(), bus.getTransactionTime(ModelledBusI2C::FAILED_CLOCKS));
+}
+
+TEST_F(SM72445_ModelledBus, clockStretchingIsAddedPerTransaction) {
+	ModelledBusI2C stretched{i2c, ClockRate::STANDARD, 50'000u};
+
+	EXPECT_EQ(
+		stretched.getTransactionTime(ModelledBusI2C::READ_CLOCKS),
+		bus.getTransactionTime(ModelledBusI2C::READ_CLOCKS) + 50'000u
+	);
+}
+
+TEST_F(SM72445_ModelledBus, utilisationAccountsForIdleTime) {
+	EXPECT_CALL(i2c, read(_, _)).WillRepeatedly(Return(0x0ull));
+
+	EXPECT_EQ(bus.getUtilisation(), 0.0f);
+
+	bus.read(DeviceAddress::ADDR001, MemoryAddress::REG1);
+	bus.advance(bus.getBusyTime());
+	EXPECT_FLOAT_EQ(bus.getUtilisation(), 0.5f);
+
+	bus.reset();
+	EXPECT_EQ(bus.getTime(), 0u);
+	EXPECT_EQ(bus.getTransactionCount(), 0u);
+}
+
+TEST_F(SM72445_ModelledBus, separateChannelReadsCostFourTimesBulkMeasurement) {
+	EXPECT_CALL(i2c, read(_, Eq(MemoryAddress::REG1))).WillRepeatedly(Return(0x0ull));
+
+	device.getElectricalMeasurements();
+	const uint64_t bulk = bus.getTime();
+	bus.reset();
+
+	device.getInputCurrent();
+	device.getInputVoltage();
+	device.getOutputCurrent();
+	device.getOutputVoltage();
+	EXPECT_EQ(bus.getTime(), 4u * bulk);
+}
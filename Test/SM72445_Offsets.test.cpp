@@ -151,3 +151,77 @@ TEST_F(SM72445_Offsets, getOffsetReturnsNulloptIfGivenPropertyInvalid) {
 	EXPECT_CALL(i2c, read).Times(AnyNumber()).WillRepeatedly(Return(0x0ull));
 	EXPECT_EQ(sm72445.getOffset(static_cast<ElectricalProperty>(0xFFu)), nullopt);
 }
+
+TEST_F(SM72445_Offsets, offsetBuilderConvertsPhysicalUnitsToCounts) {
+	// 25.5 counts per Volt or Amp at a gain of 0.5 and vDDA of 5V.
+	const Register offsets = sm72445.getOffsetBuilder()
+								 .setOffset(ElectricalProperty::CURRENT_IN, 2.0f)
+								 .setOffset(ElectricalProperty::VOLTAGE_IN, 1.0f)
+								 .setOffset(ElectricalProperty::CURRENT_OUT, 0.0f)
+								 .setOffset(ElectricalProperty::VOLTAGE_OUT, 10.0f)
+								 .build();
+
+	EXPECT_EQ(offsets, 0xFF00'1A33ull);
+}
+
+TEST_F(SM72445_Offsets, offsetBuilderSetsOutOfRangeOffsetsToZero) {
+	EXPECT_CALL(i2c, read(_, Eq(MemoryAddress::REG4))).WillOnce(Return(0xFFFF'FFFFull));
+
+	const Register offsets = sm72445.getOffsetBuilder(true)
+								 .setOffset(ElectricalProperty::CURRENT_IN, -1.0f)
+								 .setOffset(ElectricalProperty::VOLTAGE_OUT, 10.1f)
+								 .build();
+
+	EXPECT_EQ(offsets, 0x00FF'FF00ull);
+}
+
+TEST_F(SM72445_Offsets, offsetBuilderRebuildsOffsetsReadFromDevice) {
+	EXPECT_CALL(i2c, read(_, Eq(MemoryAddress::REG4)))
+		.Times(2)
+		.WillRepeatedly(Return(0x89AB'CDEFull));
+
+	const auto offsets = sm72445.getOffsets().value();
+	auto	   builder = sm72445.getOffsetBuilder(true);
+
+	for (uint8_t i = 0; i < offsets.size(); i++) {
+		builder.setOffset(static_cast<ElectricalProperty>(i), offsets[i]);
+	}
+	EXPECT_EQ(builder.build(), 0x89AB'CDEFull);
+}
+
+TEST_F(SM72445_Offsets, offsetBuilderCommitsOnceOnlyWhenDirty) {
+	EXPECT_CALL(i2c, read(_, Eq(MemoryAddress::REG4))).WillOnce(Return(0x0ull));
+	EXPECT_CALL(i2c, write(_, Eq(MemoryAddress::REG4), Eq(0x33ull)))
+		.WillOnce(Return(0x33ull));
+
+	auto builder = sm72445.getOffsetBuilder(true);
+	EXPECT_FALSE(builder.isDirty());
+	EXPECT_EQ(builder.commit(), 0x0ull); // Not dirty, so not written.
+
+	builder.setOffset(ElectricalProperty::CURRENT_IN, 2.0f);
+	EXPECT_TRUE(builder.isDirty());
+	EXPECT_EQ(builder.commit(), 0x33ull);
+	EXPECT_FALSE(builder.isDirty());
+	EXPECT_EQ(builder.commit(), 0x33ull); // Not written again.
+}
+
+TEST_F(SM72445_Offsets, offsetBuilderIsNotDirtiedBySettingCurrentValue) {
+	EXPECT_CALL(i2c, read(_, Eq(MemoryAddress::REG4))).WillOnce(Return(0x33ull));
+	EXPECT_CALL(i2c, write(_, _, _)).Times(0);
+
+	auto builder = sm72445.getOffsetBuilder(true);
+	builder.setOffset(ElectricalProperty::CURRENT_IN, 2.0f);
+
+	EXPECT_FALSE(builder.isDirty());
+	EXPECT_EQ(builder.commit(), 0x33ull); // No-op update, so not written.
+}
+
+TEST_F(SM72445_Offsets, offsetBuilderRemainsDirtyIfCommitFails) {
+	disableI2C();
+
+	auto builder = sm72445.getOffsetBuilder(true);
+	builder.setOffset(ElectricalProperty::CURRENT_IN, 2.0f);
+
+	EXPECT_EQ(builder.commit(), nullopt);
+	EXPECT_TRUE(builder.isDirty());
+}
@@ -8,6 +8,9 @@
 
 #include "SM72445.test.hpp"
 
+#include <cstring>
+#include <vector>
+
 using Reg0 = SM72445::Reg0;
 using Reg1 = SM72445::Reg1;
 using Reg3 = SM72445::Reg3;
@@ -141,6 +144,17 @@ TEST(SM72445_Reg1, indexOperatorReturnsZeroIfGivenInvalidChannel) {
 	EXPECT_EQ(reg1[static_cast<ElectricalProperty>(0xFFu)], 0x0u);
 }
 
+TEST(SM72445_Reg1, samplesAreStorableAndCopyableAsValues) {
+	std::vector<Reg1> history(3u, Reg1(Register(0x0ul)));
+	history[1] = Reg1{0x1u, 0x2u, 0x3u, 0x4u};
+
+	Reg1 copies[3];
+	std::memcpy(copies, history.data(), sizeof(copies));
+
+	EXPECT_EQ(Register(copies[1]), Register(Reg1(0x1u, 0x2u, 0x3u, 0x4u)));
+	EXPECT_EQ(Register(copies[2]), 0x0ul);
+}
+
 TEST(SM72445_Reg3, defaultConstructsToResetValue) {
 	Reg3 reg3{};
 
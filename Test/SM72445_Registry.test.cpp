@@ -0,0 +1,152 @@
+/**
+ ******************************************************************************
+ * @file			: SM72445_Registry.test.cpp
+ * @brief			: Tests for the epoch-reclaimed fleet membership registry.
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "SM72445_X.test.hpp"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "SM72445_Registry.hpp"
+
+using ::testing::_;
+using ::testing::Eq;
+using ::testing::Return;
+
+using Register		= SM72445::Register;
+using Reg1			= SM72445::Reg1;
+using DeviceAddress = SM72445::DeviceAddress;
+using MemoryAddress = SM72445::MemoryAddress;
+using Calibration	= DeviceRegistry::Calibration;
+using Reader		= DeviceRegistry::Reader;
+
+using std::nullopt;
+
+class SM72445_Registry : public SM72445_X_Test {
+public:
+	MockedI2C i2cB{};
+
+	const Calibration revA{.5f, .5f, .5f, .5f};
+	const Calibration revB{.5f, .4f, .3f, .2f, 3.3f};
+
+	DeviceRegistry registry{{&i2c, &i2cB}};
+};
+
+TEST_F(SM72445_Registry, membershipIsGroupedByBus) {
+	EXPECT_TRUE(registry.add(7u, 1u, DeviceAddress::ADDR001, revA));
+	EXPECT_TRUE(registry.add(3u, 1u, DeviceAddress::ADDR010, revA));
+	EXPECT_TRUE(registry.add(5u, 0u, DeviceAddress::ADDR011, revB));
+	EXPECT_FALSE(registry.add(5u, 1u, DeviceAddress::ADDR100, revA)); // Duplicate id.
+	EXPECT_FALSE(registry.add(9u, 2u, DeviceAddress::ADDR100, revA)); // No such bus.
+
+	auto reader = registry.addReader();
+	ASSERT_TRUE(reader);
+	const auto snapshot = reader->pin();
+
+	EXPECT_EQ(snapshot->getVersion(), 3u);
+	EXPECT_EQ(snapshot->getMembers().size(), 3u);
+	EXPECT_EQ(snapshot->getBus(0u).size(), 1u);
+	EXPECT_EQ(snapshot->getBus(2u).size(), 0u);
+
+	std::vector<DeviceRegistry::DeviceId> ids;
+	for (const auto &member : snapshot->getBus(1u)) ids.push_back(member.id);
+	EXPECT_EQ(ids, (std::vector<DeviceRegistry::DeviceId>{3u, 7u}));
+
+	EXPECT_EQ(snapshot->find(5u)->device.getCalibration().vDDA, 3.3f);
+	EXPECT_EQ(snapshot->find(9u), nullptr);
+}
+
+TEST_F(SM72445_Registry, movedDevicesKeepTheirCalibration) {
+	EXPECT_CALL(i2c, read(_, _)).Times(0);
+	EXPECT_CALL(i2cB, read(Eq(DeviceAddress::ADDR110), Eq(MemoryAddress::REG1)))
+		.WillOnce(Return(Register(Reg1(100u, 200u, 300u, 400u))));
+
+	ASSERT_TRUE(registry.add(1u, 0u, DeviceAddress::ADDR001, revB));
+	EXPECT_TRUE(registry.move(1u, 1u, DeviceAddress::ADDR110));
+	EXPECT_FALSE(registry.move(2u, 1u, DeviceAddress::ADDR110));
+
+	auto		reader = registry.addReader();
+	const auto	snapshot = reader->pin();
+	const auto &member	 = *snapshot->find(1u);
+
+	EXPECT_EQ(member.bus, 1u);
+	EXPECT_EQ(snapshot->getBus(0u).size(), 0u);
+
+	const SM72445_X expected{i2cB, DeviceAddress::ADDR110, revB};
+	EXPECT_EQ(
+		member.device.getElectricalMeasurements(),
+		expected.convertElectricalMeasurements(Reg1(100u, 200u, 300u, 400u))
+	);
+}
+
+TEST_F(SM72445_Registry, pinnedSnapshotsOutliveChanges) {
+	ASSERT_TRUE(registry.add(1u, 0u, DeviceAddress::ADDR001, revA));
+
+	auto reader = registry.addReader();
+	{
+		const auto snapshot = reader->pin();
+
+		EXPECT_TRUE(registry.remove(1u));
+		EXPECT_FALSE(registry.remove(1u));
+		EXPECT_TRUE(registry.add(2u, 0u, DeviceAddress::ADDR010, revA));
+		EXPECT_EQ(registry.reclaim(), 2u); // Both retired while pinned.
+
+		EXPECT_EQ(snapshot->getMembers().size(), 1u);
+		EXPECT_EQ(snapshot->getMembers().begin()->id, 1u);
+	}
+	EXPECT_EQ(registry.reclaim(), 0u);
+
+	EXPECT_EQ(reader->pin()->find(2u)->device.getDeviceAddress(), DeviceAddress::ADDR010);
+}
+
+TEST_F(SM72445_Registry, readersAreLimited) {
+	std::vector<Reader> readers;
+	while (auto reader = registry.addReader()) readers.push_back(std::move(*reader));
+
+	EXPECT_EQ(readers.size(), DeviceRegistry::MAX_READERS);
+
+	readers.pop_back();
+	EXPECT_TRUE(registry.addReader());
+}
+
+TEST_F(SM72445_Registry, pollersIterateWhileOtherBusesChange) {
+	for (DeviceRegistry::DeviceId id = 0; id < 4u; id++) {
+		ASSERT_TRUE(registry.add(id, 0u, static_cast<DeviceAddress>(id + 1u), revA));
+	}
+
+	std::atomic<bool> done{false};
+	std::thread		  maintainer{[&](void) {
+		  for (DeviceRegistry::DeviceId id = 100u; !done.load(); id++) {
+			  registry.add(id, 1u, DeviceAddress::ADDR001, revB);
+			  registry.move(id, 1u, DeviceAddress::ADDR010);
+			  registry.remove(id);
+		  }
+	  }};
+
+	// Every pin sees bus 0 exactly as it was, whatever is happening on bus 1.
+	auto	 reader	 = registry.addReader();
+	uint64_t version = 0u;
+	for (size_t cycle = 0; cycle < 20'000u; cycle++) {
+		const auto snapshot = reader->pin();
+		EXPECT_GE(snapshot->getVersion(), version);
+		version = snapshot->getVersion();
+
+		DeviceRegistry::DeviceId id = 0u;
+		for (const auto &member : snapshot->getBus(0u)) {
+			EXPECT_EQ(member.id, id++);
+			EXPECT_EQ(member.device.getCalibration().vDDA, 5.0f);
+		}
+		EXPECT_EQ(id, 4u);
+		EXPECT_LE(snapshot->getBus(1u).size(), 1u);
+	}
+
+	done.store(true);
+	maintainer.join();
+
+	EXPECT_EQ(registry.reclaim(), 0u);
+}
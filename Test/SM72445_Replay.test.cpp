@@ -0,0 +1,172 @@
+/**
+ ******************************************************************************
+ * @file			: SM72445_Replay.test.cpp
+ * @brief			: Tests for the record-and-replay I2C transports.
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "SM72445_X.test.hpp"
+
+#include <sstream>
+
+#include "SM72445_Replay.hpp"
+
+using ::testing::_;
+using ::testing::Eq;
+using ::testing::Return;
+
+using Register			 = SM72445::Register;
+using DeviceAddress		 = SM72445::DeviceAddress;
+using MemoryAddress		 = SM72445::MemoryAddress;
+using ElectricalProperty = SM72445::ElectricalProperty;
+using Operation			 = I2CLog::Operation;
+
+using std::nullopt;
+
+class SM72445_Replay : public ::testing::Test {
+public:
+	I2CLog log{{
+		{0u, Operation::READ, DeviceAddress::ADDR001, MemoryAddress::REG1, 0x1ull},
+		{10u, Operation::READ, DeviceAddress::ADDR010, MemoryAddress::REG1, 0xAull},
+		{20u, Operation::READ, DeviceAddress::ADDR001, MemoryAddress::REG1, 0x2ull},
+		{30u, Operation::WRITE, DeviceAddress::ADDR001, MemoryAddress::REG3, nullopt},
+		{40u, Operation::READ, DeviceAddress::ADDR001, MemoryAddress::REG5, nullopt},
+	}};
+};
+
+TEST_F(SM72445_Replay, logSaveAndLoadRoundTrips) {
+	std::stringstream stream;
+	log.save(stream);
+
+	auto loaded = I2CLog::load(stream);
+	ASSERT_TRUE(loaded.has_value());
+	ASSERT_EQ(loaded->entries.size(), log.entries.size());
+
+	for (size_t i = 0; i < log.entries.size(); i++) {
+		EXPECT_EQ(loaded->entries[i].timestamp, log.entries[i].timestamp);
+		EXPECT_EQ(loaded->entries[i].operation, log.entries[i].operation);
+		EXPECT_EQ(loaded->entries[i].deviceAddress, log.entries[i].deviceAddress);
+		EXPECT_EQ(loaded->entries[i].memoryAddress, log.entries[i].memoryAddress);
+		EXPECT_EQ(loaded->entries[i].data, log.entries[i].data);
+	}
+}
+
+TEST_F(SM72445_Replay, logLoadRejectsMalformedLines) {
+	std::stringstream badOperation("0 X 1 e1 1\n");
+	EXPECT_EQ(I2CLog::load(badOperation), nullopt);
+
+	std::stringstream badAddress("0 R 1 42 1\n");
+	EXPECT_EQ(I2CLog::load(badAddress), nullopt);
+
+	std::stringstream badData("0 R 1 e1 zz\n");
+	EXPECT_EQ(I2CLog::load(badData), nullopt);
+}
+
+TEST_F(SM72445_Replay, logLoadRejectsTrailingText) {
+	std::stringstream extraField("0 R 1 e1 1 2\n");
+	EXPECT_EQ(I2CLog::load(extraField), nullopt);
+
+	std::stringstream damagedData("0 R 1 e1 1zz\n");
+	EXPECT_EQ(I2CLog::load(damagedData), nullopt);
+
+	std::stringstream trailingSpace("0 R 1 e1 1  \r\n");
+	EXPECT_TRUE(I2CLog::load(trailingSpace).has_value());
+}
+
+TEST_F(SM72445_Replay, logLoadRejectsUnsupportedAddresses) {
+	std::stringstream addr000("0 R 0 e1 1\n");
+	EXPECT_EQ(I2CLog::load(addr000), nullopt);
+
+	for (const char *memoryAddress : {"e2", "e6", "e7"}) {
+		std::stringstream reserved(std::string("0 R 1 ") + memoryAddress + " 1\n");
+		EXPECT_EQ(I2CLog::load(reserved), nullopt) << memoryAddress;
+	}
+}
+
+TEST_F(SM72445_Replay, logLoadRejectsTimestampsGoingBackwards) {
+	std::stringstream unsorted("20 R 1 e1 1\n10 R 1 e1 2\n");
+	EXPECT_EQ(I2CLog::load(unsorted), nullopt);
+
+	std::stringstream repeated("10 R 1 e1 1\n10 R 1 e1 2\n");
+	EXPECT_TRUE(I2CLog::load(repeated).has_value());
+}
+
+TEST_F(SM72445_Replay, replayServesEachRegisterStreamInOrder) {
+	ReplayI2C replay{log};
+
+	EXPECT_EQ(replay.read(DeviceAddress::ADDR010, MemoryAddress::REG1), 0xAull);
+	EXPECT_EQ(replay.read(DeviceAddress::ADDR001, MemoryAddress::REG1), 0x1ull);
+	EXPECT_EQ(replay.read(DeviceAddress::ADDR001, MemoryAddress::REG1), 0x2ull);
+	EXPECT_EQ(replay.read(DeviceAddress::ADDR001, MemoryAddress::REG5), nullopt);
+}
+
+TEST_F(SM72445_Replay, replayLoopsExhaustedStreamsByDefault) {
+	ReplayI2C replay{log};
+
+	replay.read(DeviceAddress::ADDR001, MemoryAddress::REG1);
+	replay.read(DeviceAddress::ADDR001, MemoryAddress::REG1);
+	EXPECT_EQ(replay.read(DeviceAddress::ADDR001, MemoryAddress::REG1), 0x1ull);
+}
+
+TEST_F(SM72445_Replay, replayFailsExhaustedStreamsIfNotLooping) {
+	ReplayI2C replay{log, ReplayI2C::Pacing::AS_FAST_AS_POSSIBLE, false};
+
+	replay.read(DeviceAddress::ADDR001, MemoryAddress::REG1);
+	replay.read(DeviceAddress::ADDR001, MemoryAddress::REG1);
+	EXPECT_EQ(replay.read(DeviceAddress::ADDR001, MemoryAddress::REG1), nullopt);
+
+	replay.rewind();
+	EXPECT_EQ(replay.read(DeviceAddress::ADDR001, MemoryAddress::REG1), 0x1ull);
+}
+
+TEST_F(SM72445_Replay, replayReturnsNulloptForUnrecordedRegisters) {
+	ReplayI2C replay{log};
+	EXPECT_EQ(replay.read(DeviceAddress::ADDR111, MemoryAddress::REG0), nullopt);
+}
+
+TEST_F(SM72445_Replay, replayWritesFollowRecordedOutcome) {
+	ReplayI2C replay{log};
+	EXPECT_EQ(replay.write(DeviceAddress::ADDR001, MemoryAddress::REG3, 0x5ull), nullopt);
+	EXPECT_EQ(replay.write(DeviceAddress::ADDR001, MemoryAddress::REG4, 0x5ull), 0x5ull);
+}
+
+TEST_F(SM72445_Replay, replayRealTimePacingWaitsForRecordedTimestamps) {
+	I2CLog paced{{
+		{0u, Operation::READ, DeviceAddress::ADDR001, MemoryAddress::REG1, 0x1ull},
+		{20'000u, Operation::READ, DeviceAddress::ADDR001, MemoryAddress::REG1, 0x2ull},
+	}};
+	ReplayI2C replay{paced, ReplayI2C::Pacing::REAL_TIME};
+
+	const auto start = std::chrono::steady_clock::now();
+	replay.read(DeviceAddress::ADDR001, MemoryAddress::REG1);
+	replay.read(DeviceAddress::ADDR001, MemoryAddress::REG1);
+	EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(20));
+}
+
+TEST_F(SM72445_X_Test, recordingI2CCapturesLiveSessionForReplay) {
+	RecordingI2C recorder{i2c};
+	SM72445_X	 recorded{recorder, DeviceAddress::ADDR001, .5f, .5f, .5f, .5f};
+
+	EXPECT_CALL(i2c, read(_, Eq(MemoryAddress::REG1)))
+		.WillOnce(Return(0x0123'4567'89AB'CDEFull));
+	EXPECT_CALL(i2c, write(_, Eq(MemoryAddress::REG3), _)).WillOnce(Return(nullopt));
+
+	auto live = recorded.getElectricalMeasurements();
+	recorded.setConfig(0x0ull);
+
+	const auto &entries = recorder.getLog().entries;
+	ASSERT_EQ(entries.size(), 2u);
+	EXPECT_EQ(entries[0].operation, Operation::READ);
+	EXPECT_EQ(entries[0].data, 0x0123'4567'89AB'CDEFull);
+	EXPECT_EQ(entries[1].operation, Operation::WRITE);
+	EXPECT_EQ(entries[1].data, nullopt);
+
+	ReplayI2C replay{recorder.getLog()};
+	SM72445_X replayed{replay, DeviceAddress::ADDR001, .5f, .5f, .5f, .5f};
+	EXPECT_EQ(replayed.getElectricalMeasurements(), live);
+	EXPECT_EQ(replayed.setConfig(0x0ull), nullopt);
+
+	recorder.clear();
+	EXPECT_TRUE(recorder.getLog().entries.empty());
+}
@@ -0,0 +1,178 @@
+/**
+ ******************************************************************************
+ * @file			: SM72445_Simulator.test.cpp
+ * @brief			: Tests for the behavioural SM72445 device simulator.
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "gtest/gtest.h"
+
+#include <cmath>
+
+#include "SM72445_Simulator.hpp"
+#include "SM72445_X.hpp"
+
+using Register			 = SM72445::Register;
+using DeviceAddress		 = SM72445::DeviceAddress;
+using MemoryAddress		 = SM72445::MemoryAddress;
+using ElectricalProperty = SM72445::ElectricalProperty;
+using PanelMode			 = SM72445_X::Config::PanelMode;
+
+using std::nullopt;
+
+class SM72445_Simulator : public ::testing::Test {
+public:
+	const SimulatedSM72445::Gains gains{.2f, .2f, .4f, .4f, 5.0f};
+	const SimulatedSM72445::Panel panel{8.0f, 22.0f, 1.2f};
+
+	SimulatedSM72445 simulator{gains};
+	SM72445_X		 sm72445{simulator, DeviceAddress::ADDR001, .2f, .2f, .4f, .4f};
+
+	void SetUp() override { simulator.addDevice(DeviceAddress::ADDR001, panel, 12.0f); }
+
+	float getMaximumPanelPower(void) const {
+		float maximum = 0.0f;
+		for (float v = 0.0f; v < panel.vOc; v += 0.01f) {
+			const float current =
+				panel.iSc * (1.0f - std::exp((v - panel.vOc) / panel.vT));
+			if (v * current > maximum) maximum = v * current;
+		}
+		return maximum;
+	}
+};
+
+TEST_F(SM72445_Simulator, transactionsWithAbsentDevicesFail) {
+	EXPECT_EQ(simulator.read(DeviceAddress::ADDR010, MemoryAddress::REG1), nullopt);
+	EXPECT_EQ(simulator.write(DeviceAddress::ADDR010, MemoryAddress::REG3, 0u), nullopt);
+
+	simulator.removeDevice(DeviceAddress::ADDR001);
+	EXPECT_EQ(sm72445.getElectricalMeasurementsRegister(), nullopt);
+}
+
+TEST_F(SM72445_Simulator, readOnlyRegistersRejectWrites) {
+	EXPECT_EQ(simulator.write(DeviceAddress::ADDR001, MemoryAddress::REG0, 0u), nullopt);
+	EXPECT_EQ(simulator.write(DeviceAddress::ADDR001, MemoryAddress::REG1, 0u), nullopt);
+}
+
+TEST_F(SM72445_Simulator, registersResetToDefaultValues) {
+	EXPECT_EQ(sm72445.getConfigRegister().value().iOutMax, 1023u);
+	EXPECT_EQ(Register(*sm72445.getThresholdRegister()), Register(SM72445::Reg5()));
+}
+
+TEST_F(SM72445_Simulator, mpptConvergesToMaximumPowerPoint) {
+	simulator.step(500u);
+
+	auto measurements = sm72445.getElectricalMeasurements().value();
+	const float power =
+		measurements[static_cast<uint8_t>(ElectricalProperty::VOLTAGE_IN)]
+		* measurements[static_cast<uint8_t>(ElectricalProperty::CURRENT_IN)];
+
+	EXPECT_NEAR(power, getMaximumPanelPower(), 0.02f * getMaximumPanelPower());
+	EXPECT_NEAR(
+		measurements[static_cast<uint8_t>(ElectricalProperty::VOLTAGE_OUT)],
+		12.0f,
+		0.05f
+	);
+}
+
+TEST_F(SM72445_Simulator, simulationIsDeterministic) {
+	SimulatedSM72445 other{gains};
+	other.addDevice(DeviceAddress::ADDR001, panel, 12.0f);
+
+	for (int i = 0; i < 100; i++) {
+		simulator.step();
+		other.step();
+		EXPECT_EQ(
+			simulator.read(DeviceAddress::ADDR001, MemoryAddress::REG1),
+			other.read(DeviceAddress::ADDR001, MemoryAddress::REG1)
+		);
+	}
+}
+
+TEST_F(SM72445_Simulator, maxOutputCurrentOverrideCurtailsOutput) {
+	auto builder = sm72445.getConfigBuilder();
+	sm72445.setConfig(builder.setMaxOutputCurrentOverride(2.0f).build());
+	simulator.step(500u);
+
+	auto point = simulator.getOperatingPoint(DeviceAddress::ADDR001).value();
+	EXPECT_LE(point.iOut, 2.0f);
+	EXPECT_GT(point.iOut, 1.0f); // Perturb and observe oscillates about the limit.
+	EXPECT_GT(point.vIn, 18.0f); // Backed off towards open circuit.
+}
+
+TEST_F(SM72445_Simulator, maxOutputVoltageOverrideBelowOutputStopsConversion) {
+	auto builder = sm72445.getConfigBuilder();
+	sm72445.setConfig(builder.setMaxOutputVoltageOverride(10.0f).build());
+	simulator.step(10u);
+
+	EXPECT_EQ(simulator.getOperatingPoint(DeviceAddress::ADDR001).value().iOut, 0.0f);
+}
+
+TEST_F(SM72445_Simulator, bbResetHoldsConverterInReset) {
+	sm72445.setConfig(sm72445.getConfigBuilder().setBbReset(true).build());
+	simulator.step();
+
+	auto point = simulator.getOperatingPoint(DeviceAddress::ADDR001).value();
+	EXPECT_EQ(point.iIn, 0.0f);
+	EXPECT_EQ(point.iOut, 0.0f);
+	EXPECT_EQ(point.vIn, panel.vOc);
+}
+
+TEST_F(SM72445_Simulator, switchPanelModeCannotRegulateBelowOutputVoltage) {
+	simulator.setOutputVoltage(DeviceAddress::ADDR001, 20.0f);
+
+	sm72445.setConfig(
+		sm72445.getConfigBuilder().setPanelModeOverride(PanelMode::USE_SWITCH).build()
+	);
+	simulator.step(500u);
+	EXPECT_GE(simulator.getOperatingPoint(DeviceAddress::ADDR001).value().vIn, 20.0f);
+
+	sm72445.setConfig(
+		sm72445.getConfigBuilder().setPanelModeOverride(PanelMode::USE_H_BRIDGE).build()
+	);
+	simulator.step(500u);
+	EXPECT_LT(simulator.getOperatingPoint(DeviceAddress::ADDR001).value().vIn, 20.0f);
+}
+
+TEST_F(SM72445_Simulator, panelModeRegisterOverrideForcesPassThrough) {
+	auto builder = sm72445.getConfigBuilder();
+	sm72445.setConfig(builder.setPanelModeRegisterOverride(true).build());
+	simulator.step();
+
+	auto point = simulator.getOperatingPoint(DeviceAddress::ADDR001).value();
+	EXPECT_TRUE(point.passThrough);
+	EXPECT_EQ(point.vIn, point.vOut);
+}
+
+TEST_F(SM72445_Simulator, currentThresholdsSelectPassThroughWithHysteresis) {
+	simulator.step(100u);
+	EXPECT_FALSE(simulator.getOperatingPoint(DeviceAddress::ADDR001).value().passThrough);
+
+	simulator.setIrradiance(DeviceAddress::ADDR001, 0.02f);
+	simulator.step(2u);
+	EXPECT_TRUE(simulator.getOperatingPoint(DeviceAddress::ADDR001).value().passThrough);
+
+	simulator.setIrradiance(DeviceAddress::ADDR001, 1.0f);
+	simulator.step(2u);
+	EXPECT_FALSE(simulator.getOperatingPoint(DeviceAddress::ADDR001).value().passThrough);
+}
+
+TEST_F(SM72445_Simulator, offsetAndThresholdWritesAreReadBack) {
+	const SM72445::Reg4 reg4{0x12u, 0x34u, 0x56u, 0x78u};
+	const SM72445::Reg5 reg5{100u, 200u, 300u, 400u};
+
+	simulator.write(DeviceAddress::ADDR001, MemoryAddress::REG4, Register(reg4));
+	simulator.write(DeviceAddress::ADDR001, MemoryAddress::REG5, Register(reg5));
+
+	EXPECT_EQ(Register(sm72445.getOffsetRegister().value()), Register(reg4));
+	EXPECT_EQ(Register(sm72445.getThresholdRegister().value()), Register(reg5));
+}
+
+TEST_F(SM72445_Simulator, analogueChannelsReportStrappedValues) {
+	simulator.setAnalogueChannels(DeviceAddress::ADDR001, SM72445::Reg0{1u, 2u, 3u, 4u});
+	EXPECT_EQ(
+		Register(sm72445.getAnalogueChannelRegister().value()),
+		Register(SM72445::Reg0(1u, 2u, 3u, 4u))
+	);
+}
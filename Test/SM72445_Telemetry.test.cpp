@@ -0,0 +1,222 @@
+/**
+ ******************************************************************************
+ * @file			: SM72445_Telemetry.test.cpp
+ * @brief			: Tests for the shared-memory telemetry segment.
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "SM72445_X.test.hpp"
+
+#include <atomic>
+#include <cstring>
+#include <thread>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "SM72445_Telemetry.hpp"
+
+using ::testing::_;
+using ::testing::Eq;
+using ::testing::Return;
+
+using Register		= SM72445::Register;
+using DeviceAddress = SM72445::DeviceAddress;
+using MemoryAddress = SM72445::MemoryAddress;
+using Record		= TelemetrySegment::Record;
+
+using std::nullopt;
+
+class SM72445_Telemetry : public SM72445_X_Test {
+public:
+	const std::string name = "/sm72445_test_" + std::to_string(getpid());
+
+	optional<TelemetrySegment> owner  = TelemetrySegment::create(name, 2u);
+	optional<TelemetrySegment> mapped = TelemetrySegment::open(name);
+};
+
+TEST_F(SM72445_Telemetry, segmentCreatesAndOpensByName) {
+	ASSERT_TRUE(owner.has_value());
+	ASSERT_TRUE(mapped.has_value());
+	EXPECT_EQ(mapped->getBusCount(), 2u);
+}
+
+TEST_F(SM72445_Telemetry, openFailsForMissingSegment) {
+	EXPECT_FALSE(TelemetrySegment::open(name + "_missing").has_value());
+}
+
+TEST_F(SM72445_Telemetry, createFailsWhileNameIsHeldByLivePublisher) {
+	ASSERT_TRUE(owner.has_value());
+	EXPECT_FALSE(TelemetrySegment::create(name, 2u).has_value());
+
+	// The live segment is left intact for its readers.
+	EXPECT_TRUE(TelemetrySegment::open(name).has_value());
+}
+
+TEST_F(SM72445_Telemetry, createReclaimsSegmentOfExitedPublisher) {
+	const std::string orphan = name + "_orphan";
+
+	// The child exits without destroying its segment, as if it had crashed.
+	const pid_t child = fork();
+	if (child == 0) _exit(TelemetrySegment::create(orphan, 1u).has_value() ? 0 : 1);
+
+	int status = 0;
+	ASSERT_EQ(waitpid(child, &status, 0), child);
+	ASSERT_TRUE(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+
+	EXPECT_TRUE(TelemetrySegment::create(orphan, 1u).has_value());
+}
+
+/**
+ * @brief Create a segment by hand in a child process which then exits, as if the child
+ * had crashed part way through TelemetrySegment::create().
+ *
+ * @param recordCreator Whether the child got as far as recording its process ID, which
+ * follows the 16 bytes of magic, version, bus count and slot size.
+ */
+static void abandonSegment(const std::string &name, bool recordCreator) {
+	const pid_t child = fork();
+	if (child == 0) {
+		const int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0644);
+		if (fd < 0) _exit(1);
+		if (recordCreator) {
+			const int32_t pid = getpid();
+			if (ftruncate(fd, 64) != 0 || pwrite(fd, &pid, sizeof(pid), 16) != sizeof(pid)) {
+				_exit(1);
+			}
+		}
+		_exit(0);
+	}
+
+	int status = 0;
+	ASSERT_EQ(waitpid(child, &status, 0), child);
+	ASSERT_TRUE(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+}
+
+TEST_F(SM72445_Telemetry, createReclaimsSegmentOfPublisherWhichDiedDuringCreation) {
+	const std::string orphan = name + "_uninitialised";
+	abandonSegment(orphan, true);
+
+	EXPECT_TRUE(TelemetrySegment::create(orphan, 1u).has_value());
+}
+
+TEST_F(SM72445_Telemetry, createReclaimsSegmentOfUnknownCreatorOnlyOnceOld) {
+	const std::string orphan = name + "_unknown";
+	abandonSegment(orphan, false);
+
+	// The creator may still be about to record itself.
+	EXPECT_FALSE(TelemetrySegment::create(orphan, 1u).has_value());
+
+	const int fd = shm_open(orphan.c_str(), O_RDWR, 0);
+	ASSERT_GE(fd, 0);
+	const struct timespec aged[2] = {{time(nullptr) - 60, 0}, {time(nullptr) - 60, 0}};
+	ASSERT_EQ(futimens(fd, aged), 0);
+	close(fd);
+
+	EXPECT_TRUE(TelemetrySegment::create(orphan, 1u).has_value());
+}
+
+TEST_F(SM72445_Telemetry, snapshotGivesUpOnSlotLeftMidStore) {
+	owner->publish(0u, DeviceAddress::ADDR001, Record{0x1u, 0x3u, 42u, 0x3u});
+
+	// Leave the slot's sequence odd, as a publisher killed during a store would. Slots
+	// are one 64-byte cache line each and follow the 64-byte header.
+	const int fd = shm_open(name.c_str(), O_RDWR, 0);
+	ASSERT_GE(fd, 0);
+	void *memory = mmap(nullptr, 128u + 64u, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	close(fd);
+	ASSERT_NE(memory, MAP_FAILED);
+
+	auto *sequence = reinterpret_cast<std::atomic<uint32_t> *>(
+		static_cast<uint8_t *>(memory) + 64u + 64u * 1u
+	);
+	ASSERT_EQ(sequence->load() % 2u, 0u);
+	sequence->fetch_add(1u);
+
+	EXPECT_EQ(mapped->snapshot(0u, DeviceAddress::ADDR001), nullopt);
+	EXPECT_TRUE(mapped->snapshot(0u, DeviceAddress::ADDR010).has_value());
+
+	sequence->fetch_add(1u);
+	EXPECT_EQ(mapped->snapshot(0u, DeviceAddress::ADDR001).value().reg3, 0x3u);
+
+	munmap(memory, 128u + 64u);
+}
+
+TEST_F(SM72445_Telemetry, openedSegmentsDoNotPublish) {
+	mapped->publish(0u, DeviceAddress::ADDR001, Record{0x1u, 0x3u, 42u, 0x3u});
+	EXPECT_EQ(mapped->snapshot(0u, DeviceAddress::ADDR001).value().flags, 0x0u);
+}
+
+TEST_F(SM72445_Telemetry, snapshotRejectsBusesOutsideSegment) {
+	EXPECT_EQ(mapped->snapshot(2u, DeviceAddress::ADDR001), nullopt);
+}
+
+TEST_F(SM72445_Telemetry, publishedRecordIsVisibleThroughSecondMapping) {
+	owner->publish(1u, DeviceAddress::ADDR101, Record{0x1u, 0x3u, 42u, 0x3u});
+
+	auto record = mapped->snapshot(1u, DeviceAddress::ADDR101).value();
+	EXPECT_EQ(record.reg1, 0x1u);
+	EXPECT_EQ(record.reg3, 0x3u);
+	EXPECT_EQ(record.timestamp, 42u);
+
+	EXPECT_EQ(mapped->snapshot(0u, DeviceAddress::ADDR101).value().flags, 0x0u);
+}
+
+TEST_F(SM72445_Telemetry, readerConvertsPublishedRegistersWithCalibration) {
+	TelemetryPublisher publisher{i2c, *owner, 0u};
+	SM72445_X		   live{publisher, DeviceAddress::ADDR001, .5f, .5f, .5f, .5f};
+
+	EXPECT_CALL(i2c, read(_, Eq(MemoryAddress::REG1)))
+		.WillOnce(Return(0x0123'4567'89AB'CDEFull));
+	EXPECT_CALL(i2c, write(_, Eq(MemoryAddress::REG3), _)).WillOnce(Return(0x5ull));
+
+	auto measurements = live.getElectricalMeasurements();
+	live.setConfig(0x5ull);
+
+	TelemetryReader reader{*mapped, 0u};
+	SM72445_X		remote{reader, DeviceAddress::ADDR001, .5f, .5f, .5f, .5f};
+
+	EXPECT_EQ(remote.getElectricalMeasurements(), measurements);
+	EXPECT_EQ(Register(remote.getConfigRegister().value()), 0x5ull);
+}
+
+TEST_F(SM72445_Telemetry, readerFailsForUnpublishedRegistersAndWrites) {
+	TelemetryReader reader{*mapped, 0u};
+
+	EXPECT_EQ(reader.read(DeviceAddress::ADDR001, MemoryAddress::REG1), nullopt);
+	EXPECT_EQ(reader.read(DeviceAddress::ADDR001, MemoryAddress::REG5), nullopt);
+	EXPECT_EQ(reader.write(DeviceAddress::ADDR001, MemoryAddress::REG3, 0x0u), nullopt);
+}
+
+TEST_F(SM72445_Telemetry, publisherDoesNotPublishFailedTransactions) {
+	TelemetryPublisher publisher{i2c, *owner, 0u};
+	disableI2C();
+
+	publisher.read(DeviceAddress::ADDR001, MemoryAddress::REG1);
+	EXPECT_EQ(mapped->snapshot(0u, DeviceAddress::ADDR001).value().flags, 0x0u);
+}
+
+TEST_F(SM72445_Telemetry, readersObserveConsistentSnapshotsUnderConcurrentPublishing) {
+	std::atomic<bool> done{false};
+
+	std::thread writer([&] {
+		for (uint64_t i = 1; i < 200'000u; i++) {
+			owner->publish(0u, DeviceAddress::ADDR001, Record{i, ~i, i, i});
+		}
+		done = true;
+	});
+
+	uint64_t inconsistent = 0u;
+	while (!done) {
+		auto record = mapped->snapshot(0u, DeviceAddress::ADDR001).value();
+		if (record.reg3 != ~record.reg1 && record.reg1 != 0u) inconsistent++;
+		if (record.timestamp != record.reg1) inconsistent++;
+	}
+	writer.join();
+
+	EXPECT_EQ(inconsistent, 0u);
+}
@@ -178,3 +178,63 @@ TEST_F(SM72445_Thresholds, getOutputLowThresholdReturnsNulloptIfGivenPropertyInv
 	EXPECT_CALL(i2c, read).Times(AnyNumber()).WillRepeatedly(Return(0x0ull));
 	EXPECT_EQ(sm72445.getCurrentThreshold(static_cast<CurrentThreshold>(0xFFu)), nullopt);
 }
+
+TEST_F(SM72445_Thresholds, thresholdBuilderConvertsAmpsToCounts) {
+	// 102.3 counts per Amp at a gain of 0.5 and vDDA of 5V.
+	const Register thresholds =
+		sm72445.getThresholdBuilder()
+			.setCurrentThreshold(CurrentThreshold::CURRENT_OUT_LOW, 2.0f)
+			.setCurrentThreshold(CurrentThreshold::CURRENT_OUT_HIGH, 10.0f)
+			.setCurrentThreshold(CurrentThreshold::CURRENT_IN_LOW, 0.0f)
+			.setCurrentThreshold(CurrentThreshold::CURRENT_IN_HIGH, 11.0f) // Invalid.
+			.build();
+
+	EXPECT_EQ(thresholds, SM72445::Register(SM72445::Reg5(205u, 0x3FFu, 0u, 0u)));
+}
+
+TEST_F(SM72445_Thresholds, thresholdBuilderDefaultsToDatasheetThresholds) {
+	EXPECT_EQ(sm72445.getThresholdBuilder().build(), Register(SM72445::Reg5()));
+}
+
+TEST_F(SM72445_Thresholds, thresholdBuilderRebuildsThresholdsReadFromDevice) {
+	EXPECT_CALL(i2c, read(_, Eq(MemoryAddress::REG5)))
+		.Times(2)
+		.WillRepeatedly(Return(0x0067'89AB'CDEFull));
+
+	const auto thresholds = sm72445.getCurrentThresholds().value();
+	auto	   builder	  = sm72445.getThresholdBuilder(true);
+
+	for (uint8_t i = 0; i < thresholds.size(); i++) {
+		builder.setCurrentThreshold(static_cast<CurrentThreshold>(i), thresholds[i]);
+	}
+	EXPECT_EQ(builder.build(), 0x0067'89AB'CDEFull);
+}
+
+TEST_F(SM72445_Thresholds, thresholdBuilderCommitsOnceOnlyWhenDirty) {
+	const Register expected = Register(SM72445::Reg5(24u, 40u, 24u, 205u));
+
+	EXPECT_CALL(i2c, read(_, _)).Times(0);
+	EXPECT_CALL(i2c, write(_, Eq(MemoryAddress::REG5), Eq(expected)))
+		.WillOnce(Return(expected));
+
+	auto builder = sm72445.getThresholdBuilder();
+	EXPECT_EQ(builder.commit(), Register(SM72445::Reg5())); // Not dirty, so not written.
+
+	builder.setCurrentThreshold(CurrentThreshold::CURRENT_IN_HIGH, 2.0f);
+	builder.setCurrentThreshold(CurrentThreshold::CURRENT_IN_HIGH, 2.0f);
+	EXPECT_EQ(builder.commit(), expected);
+	EXPECT_EQ(builder.commit(), expected); // Not written again.
+}
+
+TEST_F(SM72445_Thresholds, thresholdBuilderIsNotDirtiedBySettingCurrentValue) {
+	const Register current = Register(SM72445::Reg5(24u, 40u, 24u, 205u));
+
+	EXPECT_CALL(i2c, read(_, Eq(MemoryAddress::REG5))).WillOnce(Return(current));
+	EXPECT_CALL(i2c, write(_, _, _)).Times(0);
+
+	auto builder = sm72445.getThresholdBuilder(true);
+	builder.setCurrentThreshold(CurrentThreshold::CURRENT_IN_HIGH, 2.0f);
+
+	EXPECT_FALSE(builder.isDirty());
+	EXPECT_EQ(builder.commit(), current); // No-op update, so not written.
+}
@@ -0,0 +1,199 @@
+/**
+ ******************************************************************************
+ * @file			: SM72445_Trace.test.cpp
+ * @brief			: Tests for the driver trace points and trace recorder.
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "SM72445_X.test.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include "SM72445_TraceRecorder.hpp"
+
+using ::testing::_;
+using ::testing::HasSubstr;
+using ::testing::Not;
+using ::testing::Return;
+
+using Phase = TraceRecorder::Phase;
+
+class SM72445_Trace_Test : public SM72445_X_Test {
+public:
+	TraceRecorder recorder{};
+
+	std::string exportChromeTrace(void) const {
+		std::ostringstream stream;
+		recorder.exportChromeTrace(stream);
+		return stream.str();
+	}
+};
+
+TEST_F(SM72445_Trace_Test, emptyRecorderExportsValidTrace) {
+	EXPECT_EQ(exportChromeTrace(), "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[]}");
+}
+
+TEST_F(SM72445_Trace_Test, recordedEventsAreExportedAsBeginEndPairs) {
+	recorder.record("cycle", Phase::BEGIN);
+	recorder.record("cycle", Phase::END);
+
+	EXPECT_EQ(recorder.getEventCount(), 2u);
+
+	const std::string trace = exportChromeTrace();
+	EXPECT_THAT(trace, HasSubstr("{\"name\":\"cycle\",\"ph\":\"B\",\"ts\":"));
+	EXPECT_THAT(trace, HasSubstr("{\"name\":\"cycle\",\"ph\":\"E\",\"ts\":"));
+	EXPECT_THAT(trace, HasSubstr("\"tid\":0}"));
+}
+
+TEST_F(SM72445_Trace_Test, namesAreEscaped) {
+	recorder.record("say \"hi\"", Phase::BEGIN);
+	EXPECT_THAT(exportChromeTrace(), HasSubstr("\"name\":\"say \\\"hi\\\"\""));
+}
+
+TEST_F(SM72445_Trace_Test, eventsBeyondCapacityAreDropped) {
+	TraceRecorder small{2u};
+
+	for (int i = 0; i < 5; i++) small.record("event", Phase::BEGIN);
+
+	EXPECT_EQ(small.getEventCount(), 2u);
+	EXPECT_EQ(small.getDroppedCount(), 3u);
+}
+
+TEST_F(SM72445_Trace_Test, eachThreadRecordsIntoItsOwnBuffer) {
+	std::vector<std::thread> threads;
+	for (int t = 0; t < 4; t++) {
+		threads.emplace_back([&] {
+			for (int i = 0; i < 1'000; i++) {
+				recorder.record("work", Phase::BEGIN);
+				recorder.record("work", Phase::END);
+			}
+		});
+	}
+	for (auto &thread : threads) thread.join();
+
+	EXPECT_EQ(recorder.getEventCount(), 8'000u);
+	EXPECT_EQ(recorder.getDroppedCount(), 0u);
+
+	const std::string trace = exportChromeTrace();
+	for (int tid = 0; tid < 4; tid++) {
+		EXPECT_THAT(trace, HasSubstr("\"tid\":" + std::to_string(tid) + "}"));
+	}
+}
+
+TEST_F(SM72445_Trace_Test, threadKeepsOneBufferWhenAlternatingRecorders) {
+	TraceRecorder other{};
+
+	for (int i = 0; i < 3; i++) {
+		recorder.record("cycle", Phase::BEGIN);
+		other.record("cycle", Phase::BEGIN);
+		recorder.record("cycle", Phase::END);
+		other.record("cycle", Phase::END);
+	}
+
+	// More recorders than the per-thread cache holds.
+	std::vector<std::unique_ptr<TraceRecorder>> evictors;
+	for (int i = 0; i < 8; i++) {
+		evictors.emplace_back(new TraceRecorder{1u});
+		evictors.back()->record("evict", Phase::BEGIN);
+	}
+	recorder.record("late", Phase::BEGIN);
+
+	EXPECT_EQ(recorder.getEventCount(), 7u);
+	EXPECT_EQ(other.getEventCount(), 6u);
+
+	const std::string trace = exportChromeTrace();
+	EXPECT_THAT(trace, HasSubstr("\"tid\":0}"));
+	EXPECT_THAT(trace, Not(HasSubstr("\"tid\":1}")));
+}
+
+TEST_F(SM72445_Trace_Test, exportedTimestampsAreOrderedAndCalibrated) {
+	recorder.record("first", Phase::BEGIN);
+	std::this_thread::sleep_for(std::chrono::milliseconds(2));
+	recorder.record("first", Phase::END);
+
+	const std::string trace = exportChromeTrace();
+
+	const auto timestamp = [&](const char *phase) {
+		const std::string key = std::string("\"ph\":\"") + phase + "\",\"ts\":";
+		return std::stod(trace.substr(trace.find(key) + key.size()));
+	};
+
+	// Chrome trace timestamps are in microseconds.
+	const double elapsed = timestamp("E") - timestamp("B");
+	EXPECT_GE(elapsed, 1'500.0);
+	EXPECT_LT(elapsed, 1'000'000.0);
+}
+
+#ifdef SM72445_TRACE
+
+TEST_F(SM72445_Trace_Test, installedRecorderReceivesDriverTracePoints) {
+	EXPECT_CALL(i2c, read(_, _)).WillOnce(Return(0x0ull));
+	EXPECT_CALL(i2c, write(_, _, _)).WillOnce(Return(0x0ull));
+
+	recorder.install();
+	sm72445.getElectricalMeasurements();
+	sm72445.setConfig(0x0ull);
+	recorder.uninstall();
+
+	// Measurement, register, I2C read and conversion scopes, then setConfig.
+	EXPECT_EQ(recorder.getEventCount(), 10u);
+
+	const std::string trace = exportChromeTrace();
+	const auto		  measure = trace.find("SM72445_X::getElectricalMeasurements");
+	const auto		  read	  = trace.find("SM72445::I2C::read");
+	const auto		  convert = trace.find("SM72445_X::convertElectricalMeasurements");
+	EXPECT_LT(measure, read);
+	EXPECT_LT(read, convert);
+	EXPECT_THAT(trace, HasSubstr("SM72445_X::setConfig"));
+}
+
+TEST_F(SM72445_Trace_Test, recordersMayBeDestroyedWhileDriverIsTraced) {
+	EXPECT_CALL(i2c, read(_, _)).WillRepeatedly(Return(0x0ull));
+
+	std::atomic<bool> done{false};
+	std::thread		  poller([&] {
+		  while (!done) sm72445.getElectricalMeasurements();
+	  });
+
+	// uninstall() must wait for in-flight trace points before each recorder is freed.
+	for (int i = 0; i < 200; i++) {
+		TraceRecorder transient{64u};
+		transient.install();
+		std::this_thread::yield();
+	}
+
+	done = true;
+	poller.join();
+}
+
+TEST_F(SM72445_Trace_Test, uninstalledRecorderReceivesNothing) {
+	EXPECT_CALL(i2c, read(_, _)).WillOnce(Return(0x0ull));
+
+	recorder.install();
+	recorder.uninstall();
+	sm72445.getElectricalMeasurements();
+
+	EXPECT_EQ(recorder.getEventCount(), 0u);
+}
+
+#else
+
+TEST_F(SM72445_Trace_Test, driverWithoutTracePointsRecordsNothing) {
+	EXPECT_CALL(i2c, read(_, _)).WillOnce(Return(0x0ull));
+
+	EXPECT_FALSE(TraceRecorder::isCompiledIn());
+
+	recorder.install();
+	sm72445.getElectricalMeasurements();
+	recorder.uninstall();
+
+	EXPECT_THAT(exportChromeTrace(), Not(HasSubstr("SM72445")));
+}
+
+#endif
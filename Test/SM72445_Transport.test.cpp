@@ -0,0 +1,144 @@
+/**
+ ******************************************************************************
+ * @file			: SM72445_Transport.test.cpp
+ * @brief			: Tests for the framed raw byte transport.
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "SM72445_X.test.hpp"
+
+#include <cstring>
+
+#include "SM72445_Transport.hpp"
+
+using Register		= SM72445::Register;
+using Reg1			= SM72445::Reg1;
+using DeviceAddress = SM72445::DeviceAddress;
+using MemoryAddress = SM72445::MemoryAddress;
+using Frame			= array<uint8_t, FramedI2C::FRAME_SIZE>;
+
+using std::nullopt;
+
+/**
+ * @brief Serves and records raw frames, one per device, as they would be on the wire.
+ */
+class FakeByteTransport : public ByteTransport {
+public:
+	array<Frame, 8> frames{};  // Indexed by DeviceAddress.
+	array<bool, 8>	failing{}; // Indexed by DeviceAddress.
+	size_t			transfers = 0u;
+
+	virtual bool read(
+		DeviceAddress deviceAddress,
+		MemoryAddress memoryAddress,
+		ByteSpan	  frame
+	) override final {
+		(void)memoryAddress;
+		this->transfers++;
+
+		const uint8_t device = static_cast<uint8_t>(deviceAddress);
+		if (this->failing[device]) return false;
+
+		std::memcpy(frame.data, this->frames[device].data(), frame.size);
+		return true;
+	}
+
+	virtual bool write(
+		DeviceAddress deviceAddress,
+		MemoryAddress memoryAddress,
+		ByteSpan	  frame
+	) override final {
+		(void)memoryAddress;
+		this->transfers++;
+
+		const uint8_t device = static_cast<uint8_t>(deviceAddress);
+		if (this->failing[device]) return false;
+
+		std::memcpy(this->frames[device].data(), frame.data, frame.size);
+		return true;
+	}
+};
+
+class SM72445_Transport : public ::testing::Test {
+public:
+	FakeByteTransport transport{};
+	FramedI2C		  i2c{transport};
+
+	// 0x0023'4567'89AB'CDEF on the wire: the length byte, then LSB first.
+	const Frame frame{0x07u, 0xEFu, 0xCDu, 0xABu, 0x89u, 0x67u, 0x45u, 0x23u};
+};
+
+TEST_F(SM72445_Transport, readsValidateLengthAndAssembleLsbFirst) {
+	transport.frames[1] = frame;
+	EXPECT_EQ(
+		i2c.read(DeviceAddress::ADDR001, MemoryAddress::REG1),
+		0x0023'4567'89AB'CDEFull
+	);
+
+	transport.frames[1][0] = 0x08u;
+	EXPECT_EQ(i2c.read(DeviceAddress::ADDR001, MemoryAddress::REG1), nullopt);
+
+	transport.failing[1] = true;
+	EXPECT_EQ(i2c.read(DeviceAddress::ADDR001, MemoryAddress::REG1), nullopt);
+
+	Frame wire = frame;
+	EXPECT_EQ(FramedI2C::decode(ByteSpan{wire.data(), 7u}), nullopt); // Truncated.
+}
+
+TEST_F(SM72445_Transport, writesInsertLengthByte) {
+	EXPECT_EQ(
+		i2c.write(DeviceAddress::ADDR010, MemoryAddress::REG3, 0xFF23'4567'89AB'CDEFull),
+		0x0023'4567'89AB'CDEFull // Only seven data bytes are transmitted.
+	);
+	EXPECT_EQ(transport.frames[2], frame);
+
+	Frame wire{};
+	EXPECT_FALSE(FramedI2C::encode(0u, ByteSpan{wire.data(), 7u}));
+}
+
+TEST_F(SM72445_Transport, driverPollsThroughFramedI2C) {
+	const Reg1 reg1{100u, 200u, 300u, 400u};
+	FramedI2C::encode(Register(reg1), ByteSpan{transport.frames[1].data(), 8u});
+
+	const SM72445_X sm72445{i2c, DeviceAddress::ADDR001, .5f, .5f, .5f, .5f};
+	EXPECT_EQ(
+		sm72445.getElectricalMeasurements(),
+		sm72445.convertElectricalMeasurements(reg1)
+	);
+}
+
+TEST_F(SM72445_Transport, batchesReportEachDevice) {
+	const array devices = {DeviceAddress::ADDR001, DeviceAddress::ADDR010};
+	transport.frames[1]	 = frame;
+	transport.failing[2] = true;
+
+	array<uint8_t, 2u * FramedI2C::FRAME_SIZE> buffer{};
+	array<optional<Register>, 2>			   registers{};
+
+	const DeviceAddress *addresses = devices.data();
+	optional<Register>	*results   = registers.data();
+	const ByteSpan		 frames{buffer.data(), buffer.size()};
+
+	EXPECT_EQ(i2c.readBatch(addresses, 2u, MemoryAddress::REG1, results, frames), 1u);
+	EXPECT_EQ(registers[0], 0x0023'4567'89AB'CDEFull);
+	EXPECT_EQ(registers[1], nullopt);
+
+	const array<Register, 2> data = {0x11u, 0x22u};
+	transport.failing[2]		  = false;
+	transport.failing[1]		  = true;
+	EXPECT_EQ(
+		i2c.writeBatch(addresses, 2u, MemoryAddress::REG3, data.data(), results, frames),
+		1u
+	);
+	EXPECT_EQ(registers[0], nullopt);
+	EXPECT_EQ(registers[1], 0x22u);
+	EXPECT_EQ(transport.frames[2][1], 0x22u);
+
+	// A buffer too small for the batch performs no transfers.
+	transport.transfers = 0u;
+	const ByteSpan small{buffer.data(), buffer.size() - 1u};
+	EXPECT_EQ(i2c.readBatch(addresses, 2u, MemoryAddress::REG1, results, small), 0u);
+	EXPECT_EQ(registers[0], nullopt);
+	EXPECT_EQ(transport.transfers, 0u);
+}
@@ -0,0 +1,191 @@
+/**
+ ******************************************************************************
+ * @file			: SM72445_WarmStart.test.cpp
+ * @brief			: Tests for the warm-start register image cache.
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "SM72445_X.test.hpp"
+
+#include <cstdio>
+#include <fstream>
+
+#include "SM72445_WarmStart.hpp"
+
+using ::testing::_;
+using ::testing::Eq;
+using ::testing::Return;
+
+using Register		= SM72445::Register;
+using Reg1			= SM72445::Reg1;
+using DeviceAddress = SM72445::DeviceAddress;
+using MemoryAddress = SM72445::MemoryAddress;
+using Entry			= WarmStartCache::Entry;
+using Status		= WarmStartValidator::Status;
+
+using std::nullopt;
+
+class SM72445_WarmStart : public SM72445_X_Test {
+public:
+	const std::string path = ::testing::TempDir() + "SM72445_WarmStart.cache";
+
+	const Entry entry{0x10ull, 0x13ull, 0x14ull, 0x15ull, {.5f, .4f, .3f, .2f, 3.3f}};
+
+	void SetUp(void) override { std::remove(path.c_str()); }
+	void TearDown(void) override { std::remove(path.c_str()); }
+};
+
+TEST_F(SM72445_WarmStart, entriesSurviveReopening) {
+	{
+		auto cache = WarmStartCache::open(path, 2u);
+		ASSERT_TRUE(cache);
+		EXPECT_EQ(cache->lookup(1u, DeviceAddress::ADDR011), nullopt);
+
+		cache->store(1u, DeviceAddress::ADDR011, entry);
+		EXPECT_TRUE(cache->sync());
+	}
+
+	auto cache = WarmStartCache::open(path, 2u);
+	ASSERT_TRUE(cache);
+	EXPECT_EQ(cache->getBusCount(), 2u);
+	EXPECT_EQ(cache->lookup(0u, DeviceAddress::ADDR011), nullopt);
+	EXPECT_EQ(cache->lookup(2u, DeviceAddress::ADDR011), nullopt); // No such bus.
+
+	const auto cached = cache->lookup(1u, DeviceAddress::ADDR011);
+	ASSERT_TRUE(cached);
+	EXPECT_EQ(cached->reg0, entry.reg0);
+	EXPECT_EQ(cached->reg5, entry.reg5);
+	EXPECT_EQ(cached->calibration.vDDA, entry.calibration.vDDA);
+
+	cache->invalidate(1u, DeviceAddress::ADDR011);
+	EXPECT_EQ(cache->lookup(1u, DeviceAddress::ADDR011), nullopt);
+}
+
+TEST_F(SM72445_WarmStart, cachedDevicePollsWithoutRereadingConfiguration) {
+	EXPECT_CALL(i2c, read(_, Eq(MemoryAddress::REG1)))
+		.WillOnce(Return(Register(Reg1(100u, 200u, 300u, 400u))));
+
+	auto cache = WarmStartCache::open(path, 1u);
+	ASSERT_TRUE(cache);
+	cache->store(0u, DeviceAddress::ADDR010, entry);
+
+	const SM72445_X device = cache->lookup(0u, DeviceAddress::ADDR010)
+								 ->makeDevice(i2c, DeviceAddress::ADDR010);
+	const SM72445_X expected{i2c, DeviceAddress::ADDR010, .5f, .4f, .3f, .2f, 3.3f};
+
+	EXPECT_EQ(device.getDeviceAddress(), DeviceAddress::ADDR010);
+	EXPECT_EQ(
+		device.getElectricalMeasurements(),
+		expected.convertElectricalMeasurements(Reg1(100u, 200u, 300u, 400u))
+	);
+}
+
+TEST_F(SM72445_WarmStart, corruptedEntriesAreMisses) {
+	{
+		auto cache = WarmStartCache::open(path, 1u);
+		ASSERT_TRUE(cache);
+		cache->store(0u, DeviceAddress::ADDR001, entry);
+		cache->store(0u, DeviceAddress::ADDR111, entry); // The last slot in the file.
+	}
+	{
+		std::fstream file{path, std::ios::in | std::ios::out | std::ios::binary};
+		file.seekp(-8, std::ios::end); // Within the last slot's calibration.
+		file.put('\x5A');
+	}
+
+	auto cache = WarmStartCache::open(path, 1u);
+	ASSERT_TRUE(cache);
+	EXPECT_TRUE(cache->lookup(0u, DeviceAddress::ADDR001));
+	EXPECT_EQ(cache->lookup(0u, DeviceAddress::ADDR111), nullopt);
+}
+
+TEST_F(SM72445_WarmStart, incompatibleFileIsRecreatedEmpty) {
+	{
+		auto cache = WarmStartCache::open(path, 1u);
+		ASSERT_TRUE(cache);
+		cache->store(0u, DeviceAddress::ADDR001, entry);
+	}
+
+	auto cache = WarmStartCache::open(path, 3u);
+	ASSERT_TRUE(cache);
+	EXPECT_EQ(cache->getBusCount(), 3u);
+	EXPECT_EQ(cache->lookup(0u, DeviceAddress::ADDR001), nullopt);
+
+	EXPECT_EQ(WarmStartCache::open(::testing::TempDir() + "missing/cache", 1u), nullopt);
+}
+
+TEST_F(SM72445_WarmStart, discoveredDevicesAreStored) {
+	auto cache = WarmStartCache::open(path, 1u);
+	ASSERT_TRUE(cache);
+
+	DeviceDiscovery::Device device{0u, DeviceAddress::ADDR100, 0x1ull, {}, {}, {}};
+	device.reg3 = 0x3ull;
+	device.reg4 = 0x4ull;
+	EXPECT_FALSE(cache->store(device, entry.calibration)); // REG5 unknown.
+
+	device.reg5 = 0x5ull;
+	EXPECT_TRUE(cache->store(device, entry.calibration));
+	EXPECT_EQ(cache->lookup(0u, DeviceAddress::ADDR100)->reg5, 0x5ull);
+}
+
+TEST_F(SM72445_WarmStart, validatorReadsOneRegisterPerCall) {
+	auto cache = WarmStartCache::open(path, 1u);
+	ASSERT_TRUE(cache);
+	cache->store(0u, DeviceAddress::ADDR101, entry);
+
+	EXPECT_CALL(i2c, read(Eq(DeviceAddress::ADDR101), Eq(MemoryAddress::REG0)))
+		.WillOnce(Return(entry.reg0));
+	EXPECT_CALL(i2c, read(Eq(DeviceAddress::ADDR101), Eq(MemoryAddress::REG3)))
+		.WillOnce(Return(0x33ull));
+	EXPECT_CALL(i2c, read(Eq(DeviceAddress::ADDR101), Eq(MemoryAddress::REG4)))
+		.WillOnce(Return(nullopt))
+		.WillOnce(Return(entry.reg4));
+	EXPECT_CALL(i2c, read(Eq(DeviceAddress::ADDR101), Eq(MemoryAddress::REG5)))
+		.WillOnce(Return(entry.reg5));
+
+	WarmStartValidator validator{*cache, i2c, 0u};
+	EXPECT_FALSE(validator.isComplete());
+
+	EXPECT_EQ(validator.validateNext(), Status::MATCHED);
+	EXPECT_EQ(validator.validateNext(), Status::CHANGED);
+	EXPECT_EQ(validator.validateNext(), Status::FAILED);
+	EXPECT_EQ(validator.validateNext(), Status::MATCHED); // REG4, retried.
+	EXPECT_EQ(validator.validateNext(), Status::MATCHED);
+	EXPECT_TRUE(validator.isComplete());
+	EXPECT_EQ(validator.validateNext(), Status::COMPLETE);
+
+	EXPECT_EQ(validator.getChangedCount(), 1u);
+	EXPECT_EQ(validator.getFailedCount(), 1u);
+	EXPECT_EQ(cache->lookup(0u, DeviceAddress::ADDR101)->reg3, 0x33ull);
+	EXPECT_EQ(cache->lookup(0u, DeviceAddress::ADDR101)->reg4, entry.reg4);
+}
+
+TEST_F(SM72445_WarmStart, validatorEvictsDevicesWhichStopResponding) {
+	auto cache = WarmStartCache::open(path, 1u);
+	ASSERT_TRUE(cache);
+	cache->store(0u, DeviceAddress::ADDR001, entry);
+	cache->store(0u, DeviceAddress::ADDR010, entry);
+
+	EXPECT_CALL(i2c, read(Eq(DeviceAddress::ADDR001), _))
+		.Times(WarmStartValidator::MAX_ATTEMPTS)
+		.WillRepeatedly(Return(nullopt));
+	EXPECT_CALL(i2c, read(Eq(DeviceAddress::ADDR010), _))
+		.Times(WarmStartValidator::REGISTERS.size())
+		.WillRepeatedly(Return(entry.reg0));
+
+	WarmStartValidator validator{*cache, i2c, 0u};
+
+	for (uint8_t i = 1u; i < WarmStartValidator::MAX_ATTEMPTS; i++) {
+		EXPECT_EQ(validator.validateNext(), Status::FAILED);
+	}
+	EXPECT_EQ(validator.validateNext(), Status::EVICTED);
+	EXPECT_EQ(cache->lookup(0u, DeviceAddress::ADDR001), nullopt);
+
+	// Validation moves on to the next device.
+	while (validator.validateNext() != Status::COMPLETE) {}
+
+	EXPECT_EQ(validator.getFailedCount(), WarmStartValidator::MAX_ATTEMPTS);
+	EXPECT_EQ(validator.getEvictedCount(), 1u);
+	EXPECT_TRUE(cache->lookup(0u, DeviceAddress::ADDR010).has_value());
+}
@@ -0,0 +1,115 @@
+/**
+ ******************************************************************************
+ * @file			: SM72445_WriteCoalescer.test.cpp
+ * @brief			: Tests for the latest-wins REG3 write coalescer.
+ * @author			: Lawrence Stanton
+ ******************************************************************************
+ */
+
+#include "SM72445_X.test.hpp"
+
+#include "SM72445_WriteCoalescer.hpp"
+
+using ::testing::_;
+using ::testing::Eq;
+using ::testing::Return;
+using ::testing::ReturnArg;
+
+using Register		= SM72445::Register;
+using Reg3			= SM72445::Reg3;
+using MemoryAddress = SM72445::MemoryAddress;
+
+using std::nullopt;
+
+class SM72445_WriteCoalescer : public SM72445_X_Test {
+public:
+	// 102.3 counts per Amp or Volt at a gain of 0.5 and vDDA of 5V.
+	Register getLimits(float current, float voltage) const {
+		return sm72445.getConfigBuilder()
+			.setMaxOutputCurrentOverride(current)
+			.setMaxOutputVoltageOverride(voltage)
+			.build();
+	}
+};
+
+TEST_F(SM72445_WriteCoalescer, latestSubmissionWinsWithOneWritePerFlush) {
+	const Register latest = getLimits(3.0f, 9.0f);
+
+	EXPECT_CALL(i2c, write(_, Eq(MemoryAddress::REG3), Eq(latest)))
+		.WillOnce(ReturnArg<2>());
+
+	ConfigWriteCoalescer coalescer{sm72445};
+	coalescer.submit(getLimits(1.0f, 9.0f));
+	coalescer.submit(getLimits(2.0f, 9.0f));
+	coalescer.submit(latest);
+
+	EXPECT_EQ(coalescer.getCoalescedCount(), 2u);
+	EXPECT_EQ(coalescer.flush(), latest);
+	EXPECT_FALSE(coalescer.isPending());
+	EXPECT_EQ(coalescer.flush(), nullopt); // Nothing pending, nothing written.
+}
+
+TEST_F(SM72445_WriteCoalescer, imageAlreadyOnDeviceIsNotWritten) {
+	EXPECT_CALL(i2c, read(_, Eq(MemoryAddress::REG3)))
+		.WillOnce(Return(getLimits(1.0f, 9.0f)));
+	EXPECT_CALL(i2c, write(_, _, _)).Times(0);
+
+	ConfigWriteCoalescer coalescer{sm72445};
+	coalescer.load();
+	coalescer.submit(getLimits(1.0f, 9.0f));
+
+	EXPECT_EQ(coalescer.flush(), nullopt);
+	EXPECT_FALSE(coalescer.isPending());
+}
+
+TEST_F(SM72445_WriteCoalescer, overrideCountsAreSlewRateLimited) {
+	const Reg3 start(getLimits(1.0f, 9.0f));
+	const Reg3 target(getLimits(2.0f, 8.0f)); // iOutMax +102, vOutMax -102 counts.
+
+	EXPECT_CALL(i2c, write(_, Eq(MemoryAddress::REG3), _))
+		.Times(3)
+		.WillRepeatedly(ReturnArg<2>());
+
+	ConfigWriteCoalescer coalescer{sm72445, 50u};
+	coalescer.setKnownImage(start);
+	coalescer.submit(Register(target));
+
+	const Reg3 first(*coalescer.flush());
+	EXPECT_EQ(first.iOutMax, start.iOutMax + 50u);
+	EXPECT_EQ(first.vOutMax, start.vOutMax - 50u);
+	EXPECT_TRUE(coalescer.isPending());
+
+	const Reg3 second(*coalescer.flush());
+	EXPECT_EQ(second.iOutMax, start.iOutMax + 100u);
+
+	EXPECT_EQ(coalescer.flush(), Register(target));
+	EXPECT_FALSE(coalescer.isPending());
+}
+
+TEST_F(SM72445_WriteCoalescer, slewContinuesTowardsLatestSubmission) {
+	const Reg3 start(getLimits(1.0f, 9.0f));
+
+	EXPECT_CALL(i2c, write(_, _, _)).Times(2).WillRepeatedly(ReturnArg<2>());
+
+	ConfigWriteCoalescer coalescer{sm72445, 50u};
+	coalescer.setKnownImage(start);
+
+	coalescer.submit(getLimits(3.0f, 9.0f));
+	coalescer.flush();
+
+	coalescer.submit(getLimits(1.0f, 9.0f)); // Reverse before the first target is met.
+	EXPECT_EQ(coalescer.flush(), Register(start));
+	EXPECT_FALSE(coalescer.isPending());
+}
+
+TEST_F(SM72445_WriteCoalescer, failedWriteRemainsPending) {
+	disableI2C();
+
+	ConfigWriteCoalescer coalescer{sm72445};
+	coalescer.submit(getLimits(1.0f, 9.0f));
+
+	EXPECT_EQ(coalescer.flush(), nullopt);
+	EXPECT_TRUE(coalescer.isPending());
+	EXPECT_EQ(coalescer.load(), nullopt);
+	EXPECT_EQ(coalescer.getKnownImage(), nullopt);
+}
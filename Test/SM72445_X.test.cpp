@@ -16,11 +16,11 @@ using ElectricalProperty = SM72445::ElectricalProperty;
 TEST_F(SM72445_X_Test, constructorAssignsArguments) {
 	ASSERT_EQ(&sm72445.i2c, &i2c);
 	ASSERT_EQ(sm72445.getDeviceAddress(), DeviceAddress::ADDR001);
-	ASSERT_EQ(sm72445.vInGain, .5f);
-	ASSERT_EQ(sm72445.vOutGain, .5f);
-	ASSERT_EQ(sm72445.iInGain, .5f);
-	ASSERT_EQ(sm72445.iOutGain, .5f);
-	ASSERT_EQ(sm72445.vDDA, 5.0f);
+	ASSERT_EQ(sm72445.getCalibration().vInGain, .5f);
+	ASSERT_EQ(sm72445.getCalibration().vOutGain, .5f);
+	ASSERT_EQ(sm72445.getCalibration().iInGain, .5f);
+	ASSERT_EQ(sm72445.getCalibration().iOutGain, .5f);
+	ASSERT_EQ(sm72445.getCalibration().vDDA, 5.0f);
 }
 
 TEST_F(SM72445_X_Test, convertAdcResultToPinVoltageNormallyConvertsValue) {